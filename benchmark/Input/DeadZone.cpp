@@ -0,0 +1,99 @@
+#include "../../src/Core/Events.h"
+#include "../../src/Input/InputManager.h"
+#include "../../src/Input/InputRecord.h"
+#include "../../src/Input/Modifiers/DeadZoneModifier.h"
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <vector>
+
+namespace Engine3
+{
+	namespace
+	{
+		constexpr std::int32_t Players = 8;
+
+		// A frame of every player moving both sticks.
+		std::vector<InputRecord> StickFrame()
+		{
+			std::vector<InputRecord> frame;
+			for (std::int32_t player = 0; player < Players; ++player)
+			{
+				for (int axis = SDL_CONTROLLER_AXIS_LEFTX; axis <= SDL_CONTROLLER_AXIS_RIGHTY; ++axis)
+				{
+					const float value = std::sin(static_cast<float>(player * 4 + axis));
+					frame.push_back({
+						{}, static_cast<SDL_GameControllerAxis>(axis), ProcessState::Continuous, value, player
+					});
+				}
+			}
+
+			return frame;
+		}
+	}
+
+	// Each axis bound on its own with a dead zone, so they're dispatched and dead zoned separately.
+	void SticksAsAxes(benchmark::State& state)
+	{
+		InputManager inputManager;
+		float sum = 0;
+		for (Input::GamepadAxis axis : {
+			     Input::GamepadAxis::LeftX, Input::GamepadAxis::LeftY, Input::GamepadAxis::RightX,
+			     Input::GamepadAxis::RightY
+		     })
+		{
+			inputManager.AddAction(std::function([&sum](float value) { sum += value; }))
+			            .AddInput(axis)
+			            .AddModifier<DeadZoneModifier>(0.2f);
+		}
+
+		Events events;
+		const std::vector<InputRecord> frame = StickFrame();
+		for (auto _ : state) { events.Replay(inputManager, frame); }
+
+		benchmark::DoNotOptimize(sum);
+		state.SetItemsProcessed(state.iterations() * frame.size());
+	}
+
+	BENCHMARK(SticksAsAxes);
+
+	// Each stick bound as a whole, paired and dead zoned in one pass over every controller.
+	void SticksPaired(benchmark::State& state)
+	{
+		InputManager inputManager;
+		float sum = 0;
+		for (Input::GamepadStick stick : {Input::GamepadStick::Left, Input::GamepadStick::Right})
+		{
+			inputManager.AddAction(std::function([&sum](Vector<2> value) { sum += value.X(); })).AddInput(stick);
+		}
+
+		Events events;
+		const std::vector<InputRecord> frame = StickFrame();
+		for (auto _ : state) { events.Replay(inputManager, frame); }
+
+		benchmark::DoNotOptimize(sum);
+		state.SetItemsProcessed(state.iterations() * frame.size());
+	}
+
+	BENCHMARK(SticksPaired);
+
+	void DeadZoneBatch(benchmark::State& state)
+	{
+		const DeadZone deadZone;
+		std::vector<float> x(state.range(0)), y(state.range(0));
+		for (std::size_t i = 0; i < x.size(); ++i)
+		{
+			x[i] = std::sin(static_cast<float>(i));
+			y[i] = std::cos(static_cast<float>(i));
+		}
+
+		for (auto _ : state)
+		{
+			deadZone(x, y);
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * x.size());
+	}
+
+	BENCHMARK(DeadZoneBatch)->Arg(Players * 2)->Arg(1024);
+}
@@ -0,0 +1,224 @@
+#include "../../src/Input/InputManager.h"
+#include "../../src/Input/Conditions/PressedCondition.h"
+#include "../../src/Input/Conditions/ReleasedCondition.h"
+#include "../../src/Input/Modifiers/DeadZoneModifier.h"
+#include "../../src/Input/Modifiers/SwizzleModifier.h"
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+namespace Engine3
+{
+	namespace
+	{
+		// A key event or a mouse motion event, picked at random from what the actions are bound to.
+		std::vector<InternalInputType> RandomEvents(std::size_t count)
+		{
+			std::mt19937 generator{1};
+			std::uniform_int_distribution<int> scancode{SDL_SCANCODE_A, SDL_SCANCODE_0};
+			std::bernoulli_distribution isMouse{0.5};
+
+			std::vector<InternalInputType> events(count);
+			for (InternalInputType& event : events)
+			{
+				if (isMouse(generator)) { event = Input::Mouse::MouseAxisX; }
+				else { event = static_cast<SDL_Scancode>(scancode(generator)); }
+			}
+
+			return events;
+		}
+	}
+
+	// A frame of a thousand events dispatched to five hundred actions, each bound to a key and a mouse axis.
+	void InputManagerUpdate(benchmark::State& state)
+	{
+		InputManager inputManager;
+		std::size_t calls = 0;
+		for (int i = 0; i < 500; ++i)
+		{
+			Action& action = inputManager.AddAction(std::function([&calls](float) { ++calls; }));
+			action.AddInput(static_cast<Input::Key>(SDL_SCANCODE_A + i % (SDL_SCANCODE_0 - SDL_SCANCODE_A + 1)));
+			if (i % 10 == 0) { action.AddInput(Input::Mouse::MouseAxisX); }
+		}
+
+		const std::vector<InternalInputType> events = RandomEvents(1000);
+		for (auto _ : state)
+		{
+			for (const InternalInputType& event : events) { inputManager.Update(event, ProcessState::Once, 1.f); }
+			inputManager.Process();
+		}
+
+		benchmark::DoNotOptimize(calls);
+		state.SetItemsProcessed(state.iterations() * events.size());
+	}
+
+	BENCHMARK(InputManagerUpdate);
+
+	// Ten thousand held inputs, each with a dead zone, a swizzle and a condition to run every frame.
+	void InputManagerProcess(benchmark::State& state)
+	{
+		InputManager inputManager;
+		float sum = 0;
+		for (int i = 0; i < 1000; ++i)
+		{
+			Action& action = inputManager.AddAction(std::function([&sum](Vector<2> value) { sum += value.X(); }), true);
+			for (int key = 0; key < 10; ++key)
+			{
+				action.AddInput(static_cast<Input::Key>(SDL_SCANCODE_A + key))
+				      .AddModifier<DeadZoneModifier>(0.1f)
+				      .AddModifier<SwizzleModifier>()
+				      .AddCondition<ReleasedCondition>();
+			}
+		}
+
+		for (auto _ : state)
+		{
+			// Released inputs stop after being processed, so are released again each frame.
+			for (int key = 0; key < 10; ++key)
+			{
+				inputManager.Update(static_cast<SDL_Scancode>(SDL_SCANCODE_A + key), ProcessState::Release,
+				                    Vector<2>{0.5f, 1.f});
+			}
+
+			inputManager.Process();
+		}
+
+		benchmark::DoNotOptimize(sum);
+		state.SetItemsProcessed(state.iterations() * 10'000);
+	}
+
+	BENCHMARK(InputManagerProcess);
+
+	// Thousands of registered actions, of which only a handful are held each frame, as in a UI heavy build.
+	void InputManagerMostlyIdle(benchmark::State& state)
+	{
+		InputManager inputManager;
+		std::size_t calls = 0;
+		for (int i = 0; i < 5000; ++i)
+		{
+			inputManager.AddAction(std::function([&calls] { ++calls; }))
+			            .AddInput(static_cast<Input::Key>(SDL_SCANCODE_A + i % (SDL_SCANCODE_0 - SDL_SCANCODE_A + 1)))
+			            .AddCondition<PressedCondition>();
+		}
+
+		inputManager.AddAction(std::function([&calls] { ++calls; })).AddInput(Input::Key::Space);
+		inputManager.Update(SDL_SCANCODE_SPACE, ProcessState::Continuous, {});
+
+		for (auto _ : state) { inputManager.Process(); }
+
+		benchmark::DoNotOptimize(calls);
+		state.SetItemsProcessed(state.iterations());
+	}
+
+	BENCHMARK(InputManagerMostlyIdle);
+
+	namespace
+	{
+		// A typical character's bindings, with a keyboard and a controller input for each action.
+		constexpr BindingSet CharacterBindings{
+			BindAction<>(Input::Key::Space, InputBinding{Input::GamepadButton::A}.WithCondition<PressedCondition>()),
+			BindAction<>(Input::Key::E, InputBinding{Input::GamepadButton::X}.WithCondition<PressedCondition>()),
+			BindAction<>(Input::Key::LeftShift, Input::GamepadButton::LeftStick),
+			BindAction<float>(Input::Key::W, Input::Key::S, Input::GamepadAxis::LeftY).Cumulate(),
+			BindAction<float>(Input::Key::A, Input::Key::D, Input::GamepadAxis::LeftX).Cumulate(),
+			BindAction<Vector<2>>(Input::Mouse::MouseAxisX,
+			                      InputBinding{Input::GamepadStick::Right}.WithModifier<DeadZoneModifier>(0.2f)
+			                                                               .WithModifier<SwizzleModifier>()),
+			BindAction<float>(Input::Mouse::MouseWheelY, Input::GamepadAxis::TriggerRight),
+			BindAction<>(InputBinding{Input::Key::Escape}.WithCondition<ReleasedCondition>(), Input::GamepadButton::Start)
+		};
+
+		constexpr int CharacterCount = 500;
+	}
+
+	// Startup for five hundred characters' bindings, added one step at a time.
+	void InputManagerAddImperative(benchmark::State& state)
+	{
+		for (auto _ : state)
+		{
+			InputManager inputManager;
+			for (int i = 0; i < CharacterCount; ++i)
+			{
+				Action& jump = inputManager.AddAction(std::function([] {}));
+				jump.AddInput(Input::Key::Space);
+				jump.AddInput(Input::GamepadButton::A).AddCondition<PressedCondition>();
+				Action& use = inputManager.AddAction(std::function([] {}));
+				use.AddInput(Input::Key::E);
+				use.AddInput(Input::GamepadButton::X).AddCondition<PressedCondition>();
+				Action& sprint = inputManager.AddAction(std::function([] {}));
+				sprint.AddInput(Input::Key::LeftShift);
+				sprint.AddInput(Input::GamepadButton::LeftStick);
+				Action& forward = inputManager.AddAction(std::function([](float) {}), true);
+				forward.AddInput(Input::Key::W);
+				forward.AddInput(Input::Key::S);
+				forward.AddInput(Input::GamepadAxis::LeftY);
+				Action& strafe = inputManager.AddAction(std::function([](float) {}), true);
+				strafe.AddInput(Input::Key::A);
+				strafe.AddInput(Input::Key::D);
+				strafe.AddInput(Input::GamepadAxis::LeftX);
+				Action& look = inputManager.AddAction(std::function([](Vector<2>) {}));
+				look.AddInput(Input::Mouse::MouseAxisX);
+				look.AddInput(Input::GamepadStick::Right).AddModifier<DeadZoneModifier>(0.2f).AddModifier<SwizzleModifier>();
+				Action& zoom = inputManager.AddAction(std::function([](float) {}));
+				zoom.AddInput(Input::Mouse::MouseWheelY);
+				zoom.AddInput(Input::GamepadAxis::TriggerRight);
+				Action& pause = inputManager.AddAction(std::function([] {}));
+				pause.AddInput(Input::Key::Escape).AddCondition<ReleasedCondition>();
+				pause.AddInput(Input::GamepadButton::Start);
+			}
+
+			// The first lookup groups the bindings, which is part of startup.
+			benchmark::DoNotOptimize(inputManager.IsBound(SDL_SCANCODE_SPACE));
+		}
+
+		state.SetItemsProcessed(state.iterations() * CharacterCount * CharacterBindings.InputCount);
+	}
+
+	BENCHMARK(InputManagerAddImperative);
+
+	// The same bindings added from a binding set.
+	void InputManagerAddBindingSet(benchmark::State& state)
+	{
+		for (auto _ : state)
+		{
+			InputManager inputManager;
+			for (int i = 0; i < CharacterCount; ++i)
+			{
+				inputManager.AddActions(CharacterBindings, [] {}, [] {}, [] {}, [](float) {}, [](float) {},
+				                        [](Vector<2>) {}, [](float) {}, [] {});
+			}
+
+			benchmark::DoNotOptimize(inputManager.IsBound(SDL_SCANCODE_SPACE));
+		}
+
+		state.SetItemsProcessed(state.iterations() * CharacterCount * CharacterBindings.InputCount);
+	}
+
+	BENCHMARK(InputManagerAddBindingSet);
+
+	// Switching between two control schemes of five thousand actions, every other one rebound.
+	void InputManagerSwapProfile(benchmark::State& state)
+	{
+		InputManager inputManager;
+		BindingProfile onFoot{"On foot"};
+		BindingProfile vehicle{"Vehicle"};
+		for (int i = 0; i < 5000; ++i)
+		{
+			Action& action = inputManager.AddAction(std::function([] {}));
+			action.AddInput(static_cast<Input::Key>(SDL_SCANCODE_A + i % (SDL_SCANCODE_0 - SDL_SCANCODE_A + 1)));
+			if (i % 2 == 0) { vehicle.Rebind(action, 0, static_cast<SDL_Scancode>(SDL_SCANCODE_F1 + i % 12)); }
+		}
+
+		bool isDriving = false;
+		for (auto _ : state)
+		{
+			inputManager.SetProfile(isDriving ? onFoot : vehicle);
+			inputManager.Process();
+			isDriving = !isDriving;
+		}
+
+		state.SetItemsProcessed(state.iterations() * 5000);
+	}
+
+	BENCHMARK(InputManagerSwapProfile);
+}
@@ -0,0 +1,63 @@
+#include "../../src/Jobs/JobSystem.h"
+#include "../../src/Maths/Matrix.h"
+#include <benchmark/benchmark.h>
+#include <thread>
+#include <vector>
+
+namespace Engine3
+{
+	namespace
+	{
+		// Doubles the thread count from one up to every core, to show how well each benchmark scales.
+		void ThreadCounts(benchmark::internal::Benchmark* benchmark)
+		{
+			const unsigned cores = std::max(std::thread::hardware_concurrency(), 1u);
+
+			unsigned threads = 1;
+			for (; threads < cores; threads *= 2) { benchmark->Arg(threads); }
+			benchmark->Arg(cores);
+		}
+	}
+
+	// The cost of the system itself, spawning empty jobs and waiting for them all.
+	void JobSystemFanOutFanIn(benchmark::State& state)
+	{
+		JobSystem jobs{static_cast<std::size_t>(state.range(0))};
+		constexpr std::size_t jobCount = 1024;
+		for (auto _ : state)
+		{
+			JobCounter counter;
+			for (std::size_t i = 0; i < jobCount; ++i) { jobs.Run([] {}, counter); }
+			jobs.Wait(counter);
+		}
+
+		state.SetItemsProcessed(state.iterations() * jobCount);
+	}
+
+	BENCHMARK(JobSystemFanOutFanIn)->Apply(ThreadCounts)->UseRealTime();
+
+	// A synthetic frame's worth of transform updates, every local matrix combined with its parent's.
+	void JobSystemTransformUpdate(benchmark::State& state)
+	{
+		constexpr std::size_t count = 50'000;
+		const std::vector<Matrix<4>> locals(count, Matrix<4>::RotationAboutY(0.7f) * Matrix<4>::Translation(1.f, 2.f, 3.f));
+		const Matrix<4> parent = Matrix<4>::RotationAboutX(0.3f);
+		std::vector<Matrix<4>> worlds(count);
+
+		JobSystem jobs{static_cast<std::size_t>(state.range(0))};
+		for (auto _ : state)
+		{
+			jobs.ParallelFor(count, [&](std::size_t begin, std::size_t end)
+			{
+				for (std::size_t i = begin; i < end; ++i) { worlds[i] = locals[i] * parent; }
+			}, 1024);
+
+			benchmark::DoNotOptimize(worlds.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * count);
+	}
+
+	BENCHMARK(JobSystemTransformUpdate)->Apply(ThreadCounts)->UseRealTime();
+}
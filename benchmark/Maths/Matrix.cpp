@@ -0,0 +1,223 @@
+#include "../../src/Maths/Matrix.h"
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+namespace Engine3
+{
+	namespace
+	{
+		constexpr std::size_t Count = 1024;
+
+		std::vector<Matrix<4>> RandomMatrices(unsigned seed)
+		{
+			std::mt19937 generator{seed};
+			std::uniform_real_distribution<float> distribution{-10.f, 10.f};
+
+			std::vector<Matrix<4>> matrices(Count);
+			for (Matrix<4>& matrix : matrices)
+			{
+				for (float& element : matrix) { element = distribution(generator); }
+			}
+
+			return matrices;
+		}
+
+		std::vector<Vector<4>> RandomVectors(unsigned seed)
+		{
+			std::mt19937 generator{seed};
+			std::uniform_real_distribution<float> distribution{-10.f, 10.f};
+
+			std::vector<Vector<4>> vectors(Count);
+			for (Vector<4>& vector : vectors)
+			{
+				for (float& component : vector) { component = distribution(generator); }
+			}
+
+			return vectors;
+		}
+
+		/*
+		 * Scalar Reference
+		 * What MatrixBase::operator* did for every size before the 4x4 float kernels, gathering a row and a column into
+		 * temporary vectors for each element.
+		 */
+		float ScalarDotProduct(const Vector<4>& lhs, const Vector<4>& rhs)
+		{
+			float value = 0;
+			for (std::size_t i = 0; i < 4; ++i) { value += lhs[i] * rhs[i]; }
+
+			return value;
+		}
+
+		Matrix<4> ScalarMultiply(const Matrix<4>& lhs, const Matrix<4>& rhs)
+		{
+			Matrix<4> result;
+			for (std::size_t row = 0; row < 4; ++row)
+			{
+				for (std::size_t column = 0; column < 4; ++column)
+				{
+					result(row, column) = ScalarDotProduct(lhs.GetRow(row), rhs.GetColumn(column));
+				}
+			}
+
+			return result;
+		}
+
+		Vector<4> ScalarMultiply(const Vector<4>& lhs, const Matrix<4>& rhs)
+		{
+			Vector<4> result;
+			for (std::size_t column = 0; column < 4; ++column)
+			{
+				result[column] = ScalarDotProduct(lhs, rhs.GetColumn(column));
+			}
+
+			return result;
+		}
+	}
+
+	/* Matrix Product */
+	void Matrix4x4MultiplyScalar(benchmark::State& state)
+	{
+		const auto lhs = RandomMatrices(1);
+		const auto rhs = RandomMatrices(2);
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < Count; ++i)
+			{
+				auto result = ScalarMultiply(lhs[i], rhs[i]);
+				benchmark::DoNotOptimize(result);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * Count);
+	}
+
+	void Matrix4x4Multiply(benchmark::State& state)
+	{
+		const auto lhs = RandomMatrices(1);
+		const auto rhs = RandomMatrices(2);
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < Count; ++i)
+			{
+				auto result = lhs[i] * rhs[i];
+				benchmark::DoNotOptimize(result);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * Count);
+	}
+
+	BENCHMARK(Matrix4x4MultiplyScalar);
+	BENCHMARK(Matrix4x4Multiply);
+
+	/* Row Vector Product */
+	void Matrix4x4TransformScalar(benchmark::State& state)
+	{
+		const auto vectors = RandomVectors(1);
+		const Matrix<4> matrix = RandomMatrices(2).front();
+		for (auto _ : state)
+		{
+			for (const Vector<4>& vector : vectors)
+			{
+				auto result = ScalarMultiply(vector, matrix);
+				benchmark::DoNotOptimize(result);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * Count);
+	}
+
+	void Matrix4x4Transform(benchmark::State& state)
+	{
+		const auto vectors = RandomVectors(1);
+		const Matrix<4> matrix = RandomMatrices(2).front();
+		for (auto _ : state)
+		{
+			for (const Vector<4>& vector : vectors)
+			{
+				auto result = vector * matrix;
+				benchmark::DoNotOptimize(result);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * Count);
+	}
+
+	BENCHMARK(Matrix4x4TransformScalar);
+	BENCHMARK(Matrix4x4Transform);
+
+	/* Inverse */
+	// Random matrices are almost never singular, and the affine variants only read the upper 3x3 and translation, so
+	// the same inputs can be used for every inverse.
+	void Matrix4x4InvertedCofactorExpansion(benchmark::State& state)
+	{
+		const auto matrices = RandomMatrices(1);
+		for (auto _ : state)
+		{
+			for (const Matrix<4>& matrix : matrices)
+			{
+				// The recursive expansion every square matrix used before Matrix<4> had its own.
+				auto result = static_cast<const Detail::MatrixBase<4, 4, float>&>(matrix).Inverted();
+				benchmark::DoNotOptimize(result);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * Count);
+	}
+
+	void Matrix4x4Inverted(benchmark::State& state)
+	{
+		const auto matrices = RandomMatrices(1);
+		for (auto _ : state)
+		{
+			for (const Matrix<4>& matrix : matrices)
+			{
+				auto result = matrix.Inverted();
+				benchmark::DoNotOptimize(result);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * Count);
+	}
+
+	void Matrix4x4InvertedAffine(benchmark::State& state)
+	{
+		auto matrices = RandomMatrices(1);
+		for (Matrix<4>& matrix : matrices) { matrix.SetColumn(3, {0, 0, 0, 1}); }
+
+		for (auto _ : state)
+		{
+			for (const Matrix<4>& matrix : matrices)
+			{
+				auto result = matrix.InvertedAffine();
+				benchmark::DoNotOptimize(result);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * Count);
+	}
+
+	void Matrix4x4InvertedOrthonormal(benchmark::State& state)
+	{
+		auto matrices = RandomMatrices(1);
+		for (Matrix<4>& matrix : matrices) { matrix.SetColumn(3, {0, 0, 0, 1}); }
+
+		for (auto _ : state)
+		{
+			for (const Matrix<4>& matrix : matrices)
+			{
+				auto result = matrix.InvertedOrthonormal();
+				benchmark::DoNotOptimize(result);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * Count);
+	}
+
+	BENCHMARK(Matrix4x4InvertedCofactorExpansion);
+	BENCHMARK(Matrix4x4Inverted);
+	BENCHMARK(Matrix4x4InvertedAffine);
+	BENCHMARK(Matrix4x4InvertedOrthonormal);
+}
@@ -0,0 +1,256 @@
+#include "../../src/Maths/Quaternion.h"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace Engine3
+{
+	namespace
+	{
+		constexpr std::size_t Count = 1024;
+
+		std::vector<Vector<3>> RandomEulerAngles()
+		{
+			std::mt19937 generator{1};
+			std::uniform_real_distribution<float> distribution{-3.f, 3.f};
+
+			std::vector<Vector<3>> angles(Count);
+			for (Vector<3>& angle : angles)
+			{
+				for (float& component : angle) { component = distribution(generator); }
+			}
+
+			return angles;
+		}
+
+		// The same orientations as RandomEulerAngles, applied in the same order as EulerToMatrix's XYZ mode.
+		std::vector<Quaternion<float>> RandomRotations()
+		{
+			std::vector<Quaternion<float>> rotations;
+			for (const Vector<3>& angle : RandomEulerAngles())
+			{
+				rotations.push_back(
+					Quaternion<float>::FromAxisAngle({1, 0, 0}, angle.X()) *
+					Quaternion<float>::FromAxisAngle({0, 1, 0}, angle.Y()) *
+					Quaternion<float>::FromAxisAngle({0, 0, 1}, angle.Z()));
+			}
+
+			return rotations;
+		}
+	}
+
+	/* Orientation To Matrix */
+	// What main.cpp's EulerToMatrix does, three rotation matrices and two products.
+	void EulerToMatrix(benchmark::State& state)
+	{
+		const auto angles = RandomEulerAngles();
+		for (auto _ : state)
+		{
+			for (const Vector<3>& angle : angles)
+			{
+				auto result = Matrix<4>::RotationAboutZ(angle.Z()) * Matrix<4>::RotationAboutY(angle.Y()) *
+					Matrix<4>::RotationAboutX(angle.X());
+				benchmark::DoNotOptimize(result);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * Count);
+	}
+
+	void QuaternionToMatrix(benchmark::State& state)
+	{
+		const auto rotations = RandomRotations();
+		for (auto _ : state)
+		{
+			for (const Quaternion<float>& rotation : rotations)
+			{
+				auto result = rotation.ToMatrix<4>();
+				benchmark::DoNotOptimize(result);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * Count);
+	}
+
+	void QuaternionToMatrices(benchmark::State& state)
+	{
+		const auto rotations = RandomRotations();
+		std::vector<Matrix<4>> result(Count);
+		for (auto _ : state)
+		{
+			ToMatrices(rotations, result);
+
+			benchmark::DoNotOptimize(result.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * Count);
+	}
+
+	BENCHMARK(EulerToMatrix);
+	BENCHMARK(QuaternionToMatrix);
+	BENCHMARK(QuaternionToMatrices);
+
+	/* Rotate Vectors */
+	// Each vector rotated by its own orientation, as when placing a part of each animated entity.
+	void EulerMatrixRotate(benchmark::State& state)
+	{
+		const auto angles = RandomEulerAngles();
+		const auto vectors = RandomEulerAngles();
+		std::vector<Vector<3>> result(Count);
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < Count; ++i)
+			{
+				const Matrix<3> matrix = Matrix<3>::RotationAboutZ(angles[i].Z()) *
+					Matrix<3>::RotationAboutY(angles[i].Y()) * Matrix<3>::RotationAboutX(angles[i].X());
+				result[i] = vectors[i] * matrix;
+			}
+
+			benchmark::DoNotOptimize(result.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * Count);
+	}
+
+	void QuaternionRotate(benchmark::State& state)
+	{
+		const auto rotations = RandomRotations();
+		const auto vectors = RandomEulerAngles();
+		std::vector<Vector<3>> result(Count);
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < Count; ++i) { result[i] = rotations[i].Rotate(vectors[i]); }
+
+			benchmark::DoNotOptimize(result.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * Count);
+	}
+
+	void QuaternionRotateBatch(benchmark::State& state)
+	{
+		const auto rotations = RandomRotations();
+		const auto vectors = RandomEulerAngles();
+		std::vector<Vector<3>> result(Count);
+		for (auto _ : state)
+		{
+			Rotate(rotations, vectors, result);
+
+			benchmark::DoNotOptimize(result.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * Count);
+	}
+
+	BENCHMARK(EulerMatrixRotate);
+	BENCHMARK(QuaternionRotate);
+	BENCHMARK(QuaternionRotateBatch);
+
+	/* Interpolation */
+	namespace
+	{
+		std::vector<float> RandomFractions()
+		{
+			std::mt19937 generator{2};
+			std::uniform_real_distribution<float> distribution{0.f, 1.f};
+
+			std::vector<float> fractions(Count);
+			for (float& fraction : fractions) { fraction = distribution(generator); }
+
+			return fractions;
+		}
+
+		/// The largest difference in any component from the exact spherical linear interpolation, reported alongside
+		/// the throughput so the trade-off is visible in one place.
+		template <class Interpolation>
+		double MaxError(Interpolation interpolation)
+		{
+			const auto starts = RandomRotations();
+			auto ends = starts;
+			std::rotate(ends.begin(), ends.begin() + 1, ends.end());
+			const auto fractions = RandomFractions();
+
+			double maxError = 0;
+			for (std::size_t i = 0; i < Count; ++i)
+			{
+				const Quaternion<float> expected = SphericalLinearInterpolation(starts[i], ends[i], fractions[i]);
+				const Quaternion<float> actual = interpolation(starts[i], ends[i], fractions[i]);
+				for (auto [lhs, rhs] : {std::pair{actual.X, expected.X}, {actual.Y, expected.Y}, {actual.Z, expected.Z},
+				                        {actual.W, expected.W}})
+				{
+					maxError = std::max(maxError, static_cast<double>(std::abs(lhs - rhs)));
+				}
+			}
+
+			return maxError;
+		}
+
+		template <class Interpolation>
+		void Interpolate(benchmark::State& state, Interpolation interpolation)
+		{
+			const auto starts = RandomRotations();
+			auto ends = starts;
+			std::rotate(ends.begin(), ends.begin() + 1, ends.end());
+			const auto fractions = RandomFractions();
+
+			for (auto _ : state)
+			{
+				for (std::size_t i = 0; i < Count; ++i)
+				{
+					auto result = interpolation(starts[i], ends[i], fractions[i]);
+					benchmark::DoNotOptimize(result);
+				}
+			}
+
+			state.SetItemsProcessed(state.iterations() * Count);
+			state.counters["MaxError"] = MaxError(interpolation);
+		}
+	}
+
+	void QuaternionSphericalLinearInterpolation(benchmark::State& state)
+	{
+		Interpolate(state, SphericalLinearInterpolation<float, float>);
+	}
+
+	void QuaternionNormalisedLinearInterpolation(benchmark::State& state)
+	{
+		Interpolate(state, NormalisedLinearInterpolation<float, float>);
+	}
+
+	void QuaternionApproximateSphericalLinearInterpolation(benchmark::State& state)
+	{
+		Interpolate(state, ApproximateSphericalLinearInterpolation<float, float>);
+	}
+
+	void QuaternionApproximateSphericalLinearInterpolationBatch(benchmark::State& state)
+	{
+		const auto starts = RandomRotations();
+		auto ends = starts;
+		std::rotate(ends.begin(), ends.begin() + 1, ends.end());
+		const auto fractions = RandomFractions();
+		std::vector<Quaternion<float>> result(Count);
+
+		for (auto _ : state)
+		{
+			ApproximateSphericalLinearInterpolation(starts, ends, fractions, result);
+
+			benchmark::DoNotOptimize(result.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * Count);
+		state.counters["MaxError"] = MaxError(ApproximateSphericalLinearInterpolation<float, float>);
+	}
+
+	BENCHMARK(QuaternionSphericalLinearInterpolation);
+	BENCHMARK(QuaternionNormalisedLinearInterpolation);
+	BENCHMARK(QuaternionApproximateSphericalLinearInterpolation);
+	BENCHMARK(QuaternionApproximateSphericalLinearInterpolationBatch);
+}
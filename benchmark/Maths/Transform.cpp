@@ -0,0 +1,122 @@
+#include "../../src/Maths/Transform.h"
+#include <benchmark/benchmark.h>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace Engine3
+{
+	namespace
+	{
+		std::vector<Vector<3>> RandomVectors(std::size_t count)
+		{
+			std::mt19937 generator{1};
+			std::uniform_real_distribution<float> distribution{-100.f, 100.f};
+
+			std::vector<Vector<3>> vectors(count);
+			for (Vector<3>& vector : vectors)
+			{
+				for (float& component : vector) { component = distribution(generator); }
+			}
+
+			return vectors;
+		}
+
+		const Matrix<4> BenchmarkMatrix = Matrix<4>::RotationAboutY(0.7f) * Matrix<4>::Translation(4.f, -1.f, 2.5f);
+	}
+
+	/* Transform Points */
+	// What callers had to do before the batch API, a product per point through Vector<4>.
+	void TransformPointsLoop(benchmark::State& state)
+	{
+		const auto points = RandomVectors(state.range(0));
+		std::vector<Vector<3>> result(points.size());
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < points.size(); ++i)
+			{
+				const Vector<4> transformed = Vector<4>{points[i].X(), points[i].Y(), points[i].Z(), 1} * BenchmarkMatrix;
+				result[i] = {transformed.X(), transformed.Y(), transformed.Z()};
+			}
+
+			benchmark::DoNotOptimize(result.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void TransformPointsBatch(benchmark::State& state)
+	{
+		const auto points = RandomVectors(state.range(0));
+		std::vector<Vector<3>> result(points.size());
+		for (auto _ : state)
+		{
+			TransformPoints(points, result, BenchmarkMatrix);
+
+			benchmark::DoNotOptimize(result.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void TransformPointsThreaded(benchmark::State& state)
+	{
+		const auto points = RandomVectors(state.range(0));
+		std::vector<Vector<3>> result(points.size());
+		for (auto _ : state)
+		{
+			TransformPoints(points, result, BenchmarkMatrix, std::thread::hardware_concurrency());
+
+			benchmark::DoNotOptimize(result.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	BENCHMARK(TransformPointsLoop)->Arg(1 << 10)->Arg(1 << 20);
+	BENCHMARK(TransformPointsBatch)->Arg(1 << 10)->Arg(1 << 20);
+	BENCHMARK(TransformPointsThreaded)->Arg(1 << 20)->UseRealTime();
+
+	/* Projective Transform */
+	void TransformPointsProjectiveLoop(benchmark::State& state)
+	{
+		const Matrix<4> matrix = BenchmarkMatrix * Matrix<4>::PerspectiveProjection(2.f);
+		const auto points = RandomVectors(state.range(0));
+		std::vector<Vector<3>> result(points.size());
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < points.size(); ++i)
+			{
+				const Vector<4> transformed = Vector<4>{points[i].X(), points[i].Y(), points[i].Z(), 1} * matrix;
+				result[i] = Vector<3>{transformed.X(), transformed.Y(), transformed.Z()} / transformed.W();
+			}
+
+			benchmark::DoNotOptimize(result.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void TransformPointsProjectiveBatch(benchmark::State& state)
+	{
+		const Matrix<4> matrix = BenchmarkMatrix * Matrix<4>::PerspectiveProjection(2.f);
+		const auto points = RandomVectors(state.range(0));
+		std::vector<Vector<3>> result(points.size());
+		for (auto _ : state)
+		{
+			TransformPointsProjective(points, result, matrix);
+
+			benchmark::DoNotOptimize(result.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	BENCHMARK(TransformPointsProjectiveLoop)->Arg(1 << 10);
+	BENCHMARK(TransformPointsProjectiveBatch)->Arg(1 << 10);
+}
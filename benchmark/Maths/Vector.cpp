@@ -0,0 +1,224 @@
+#include "../../src/Maths/Vector.h"
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+namespace Engine3
+{
+	namespace
+	{
+		// Large enough to fall out of L1, small enough to stay in L2, so the arithmetic is what's being measured.
+		constexpr std::size_t Count = 4096;
+
+		template <std::size_t Dimensions>
+		std::vector<Vector<Dimensions>> RandomVectors(unsigned seed)
+		{
+			std::mt19937 generator{seed};
+			std::uniform_real_distribution<float> distribution{-100.f, 100.f};
+
+			std::vector<Vector<Dimensions>> vectors(Count);
+			for (Vector<Dimensions>& vector : vectors)
+			{
+				for (float& component : vector) { component = distribution(generator); }
+			}
+
+			return vectors;
+		}
+
+		/*
+		 * Scalar Reference
+		 * The loops Vector used before it had a SIMD path, kept here so there's a baseline to compare against.
+		 */
+		template <std::size_t Dimensions>
+		float ScalarDotProduct(const Vector<Dimensions>& lhs, const Vector<Dimensions>& rhs)
+		{
+			float value = 0;
+			for (std::size_t i = 0; i < Dimensions; ++i) { value += lhs[i] * rhs[i]; }
+
+			return value;
+		}
+
+		Vector<3> ScalarCrossProduct(const Vector<3>& lhs, const Vector<3>& rhs)
+		{
+			return {
+				lhs.Y() * rhs.Z() - lhs.Z() * rhs.Y(),
+				lhs.Z() * rhs.X() - lhs.X() * rhs.Z(),
+				lhs.X() * rhs.Y() - lhs.Y() * rhs.X()
+			};
+		}
+
+		template <std::size_t Dimensions>
+		Vector<Dimensions> ScalarNormalised(const Vector<Dimensions>& vector)
+		{
+			float scale = 1 / std::sqrt(ScalarDotProduct(vector, vector));
+
+			Vector<Dimensions> normalised;
+			for (std::size_t i = 0; i < Dimensions; ++i) { normalised[i] = vector[i] * scale; }
+
+			return normalised;
+		}
+
+		template <std::size_t Dimensions>
+		Vector<Dimensions> ScalarAdd(const Vector<Dimensions>& lhs, const Vector<Dimensions>& rhs)
+		{
+			Vector<Dimensions> sum;
+			for (std::size_t i = 0; i < Dimensions; ++i) { sum[i] = lhs[i] + rhs[i]; }
+
+			return sum;
+		}
+	}
+
+	/* Dot Product */
+	template <std::size_t Dimensions>
+	void VectorDotProductScalar(benchmark::State& state)
+	{
+		const auto lhs = RandomVectors<Dimensions>(1);
+		const auto rhs = RandomVectors<Dimensions>(2);
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < Count; ++i)
+			{
+				auto result = ScalarDotProduct(lhs[i], rhs[i]);
+				benchmark::DoNotOptimize(result);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * Count);
+	}
+
+	template <std::size_t Dimensions>
+	void VectorDotProduct(benchmark::State& state)
+	{
+		const auto lhs = RandomVectors<Dimensions>(1);
+		const auto rhs = RandomVectors<Dimensions>(2);
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < Count; ++i)
+			{
+				auto result = Vector<Dimensions>::DotProduct(lhs[i], rhs[i]);
+				benchmark::DoNotOptimize(result);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * Count);
+	}
+
+	BENCHMARK(VectorDotProductScalar<3>);
+	BENCHMARK(VectorDotProduct<3>);
+	BENCHMARK(VectorDotProductScalar<4>);
+	BENCHMARK(VectorDotProduct<4>);
+
+	/* Cross Product */
+	void VectorCrossProductScalar(benchmark::State& state)
+	{
+		const auto lhs = RandomVectors<3>(1);
+		const auto rhs = RandomVectors<3>(2);
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < Count; ++i)
+			{
+				auto result = ScalarCrossProduct(lhs[i], rhs[i]);
+				benchmark::DoNotOptimize(result);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * Count);
+	}
+
+	void VectorCrossProduct(benchmark::State& state)
+	{
+		const auto lhs = RandomVectors<3>(1);
+		const auto rhs = RandomVectors<3>(2);
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < Count; ++i)
+			{
+				auto result = Vector<3>::CrossProduct(lhs[i], rhs[i]);
+				benchmark::DoNotOptimize(result);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * Count);
+	}
+
+	BENCHMARK(VectorCrossProductScalar);
+	BENCHMARK(VectorCrossProduct);
+
+	/* Normalise */
+	template <std::size_t Dimensions>
+	void VectorNormaliseScalar(benchmark::State& state)
+	{
+		const auto vectors = RandomVectors<Dimensions>(1);
+		for (auto _ : state)
+		{
+			for (const Vector<Dimensions>& vector : vectors)
+			{
+				auto result = ScalarNormalised(vector);
+				benchmark::DoNotOptimize(result);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * Count);
+	}
+
+	template <std::size_t Dimensions>
+	void VectorNormalise(benchmark::State& state)
+	{
+		const auto vectors = RandomVectors<Dimensions>(1);
+		for (auto _ : state)
+		{
+			for (const Vector<Dimensions>& vector : vectors)
+			{
+				auto result = vector.Normalised();
+				benchmark::DoNotOptimize(result);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * Count);
+	}
+
+	BENCHMARK(VectorNormaliseScalar<3>);
+	BENCHMARK(VectorNormalise<3>);
+	BENCHMARK(VectorNormaliseScalar<4>);
+	BENCHMARK(VectorNormalise<4>);
+
+	/* Addition */
+	template <std::size_t Dimensions>
+	void VectorAddScalar(benchmark::State& state)
+	{
+		const auto lhs = RandomVectors<Dimensions>(1);
+		const auto rhs = RandomVectors<Dimensions>(2);
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < Count; ++i)
+			{
+				auto result = ScalarAdd(lhs[i], rhs[i]);
+				benchmark::DoNotOptimize(result);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * Count);
+	}
+
+	template <std::size_t Dimensions>
+	void VectorAdd(benchmark::State& state)
+	{
+		const auto lhs = RandomVectors<Dimensions>(1);
+		const auto rhs = RandomVectors<Dimensions>(2);
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < Count; ++i)
+			{
+				auto result = lhs[i] + rhs[i];
+				benchmark::DoNotOptimize(result);
+			}
+		}
+
+		state.SetItemsProcessed(state.iterations() * Count);
+	}
+
+	BENCHMARK(VectorAddScalar<3>);
+	BENCHMARK(VectorAdd<3>);
+	BENCHMARK(VectorAddScalar<4>);
+	BENCHMARK(VectorAdd<4>);
+}
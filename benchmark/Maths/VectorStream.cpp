@@ -0,0 +1,153 @@
+#include "../../src/Maths/VectorStream.h"
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+namespace Engine3
+{
+	namespace
+	{
+		std::vector<Vector<3>> RandomVectors(std::size_t count, unsigned seed)
+		{
+			std::mt19937 generator{seed};
+			std::uniform_real_distribution<float> distribution{1.f, 100.f};
+
+			std::vector<Vector<3>> vectors(count);
+			for (Vector<3>& vector : vectors)
+			{
+				for (float& component : vector) { component = distribution(generator); }
+			}
+
+			return vectors;
+		}
+
+		// 1K fits in L1, 100K in L2/L3, and 10M only in main memory, where both layouts become bandwidth bound.
+		void StreamSizes(benchmark::internal::Benchmark* benchmark)
+		{
+			benchmark->Arg(1'000)->Arg(100'000)->Arg(10'000'000)->Unit(benchmark::kMicrosecond);
+		}
+	}
+
+
+	/* Dot Product */
+	void VectorArrayDotProduct(benchmark::State& state)
+	{
+		const auto lhs = RandomVectors(state.range(0), 1);
+		const auto rhs = RandomVectors(state.range(0), 2);
+		std::vector<float> result(lhs.size());
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < lhs.size(); ++i) { result[i] = Vector<3>::DotProduct(lhs[i], rhs[i]); }
+
+			benchmark::DoNotOptimize(result.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void VectorStreamDotProduct(benchmark::State& state)
+	{
+		const VectorStream<3> lhs{RandomVectors(state.range(0), 1)};
+		const VectorStream<3> rhs{RandomVectors(state.range(0), 2)};
+		std::vector<float> result(lhs.Size());
+		for (auto _ : state)
+		{
+			VectorStream<3>::DotProduct(lhs, rhs, result);
+
+			benchmark::DoNotOptimize(result.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	BENCHMARK(VectorArrayDotProduct)->Apply(StreamSizes);
+	BENCHMARK(VectorStreamDotProduct)->Apply(StreamSizes);
+
+	/* Normalise */
+	void VectorArrayNormalise(benchmark::State& state)
+	{
+		auto vectors = RandomVectors(state.range(0), 1);
+		for (auto _ : state)
+		{
+			for (Vector<3>& vector : vectors) { vector.Normalise(); }
+
+			benchmark::DoNotOptimize(vectors.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void VectorStreamNormalise(benchmark::State& state)
+	{
+		VectorStream<3> vectors{RandomVectors(state.range(0), 1)};
+		for (auto _ : state)
+		{
+			vectors.Normalise();
+
+			benchmark::DoNotOptimize(vectors.X().data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	BENCHMARK(VectorArrayNormalise)->Apply(StreamSizes);
+	BENCHMARK(VectorStreamNormalise)->Apply(StreamSizes);
+
+	/* Linear Interpolation */
+	void VectorArrayLinearInterpolation(benchmark::State& state)
+	{
+		const auto start = RandomVectors(state.range(0), 1);
+		const auto end = RandomVectors(state.range(0), 2);
+		std::vector<Vector<3>> result(start.size());
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < start.size(); ++i) { result[i] = LinearInterpolation(start[i], end[i], 0.3f); }
+
+			benchmark::DoNotOptimize(result.data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	void VectorStreamLinearInterpolation(benchmark::State& state)
+	{
+		const VectorStream<3> start{RandomVectors(state.range(0), 1)};
+		const VectorStream<3> end{RandomVectors(state.range(0), 2)};
+		VectorStream<3> result{start.Size()};
+		for (auto _ : state)
+		{
+			VectorStream<3>::LinearInterpolation(start, end, 0.3f, result);
+
+			benchmark::DoNotOptimize(result.X().data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	BENCHMARK(VectorArrayLinearInterpolation)->Apply(StreamSizes);
+	BENCHMARK(VectorStreamLinearInterpolation)->Apply(StreamSizes);
+
+	/* Conversion */
+	void VectorStreamLoad(benchmark::State& state)
+	{
+		const auto vectors = RandomVectors(state.range(0), 1);
+		VectorStream<3> stream{vectors.size()};
+		for (auto _ : state)
+		{
+			stream.Load(vectors);
+
+			benchmark::DoNotOptimize(stream.X().data());
+			benchmark::ClobberMemory();
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	BENCHMARK(VectorStreamLoad)->Apply(StreamSizes);
+}
@@ -0,0 +1,110 @@
+#include "../../src/Rendering/DrawBatcher.h"
+#include "../../src/Utility/RadixSort.h"
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+namespace Engine3
+{
+	namespace
+	{
+		// Objects spread across a few layers, shaders, materials and meshes, at random depths, some translucent.
+		std::vector<SortKey> RandomKeys(std::size_t count)
+		{
+			std::mt19937 generator{1};
+			std::uniform_int_distribution<std::uint32_t> layer{0, 1};
+			std::bernoulli_distribution isTranslucent{0.1};
+			std::uniform_int_distribution<ShaderHandle> shader{0, 7};
+			std::uniform_int_distribution<MaterialHandle> material{0, 63};
+			std::uniform_int_distribution<MeshHandle> mesh{0, 255};
+			std::uniform_real_distribution<float> depth{0.f, 1.f};
+
+			std::vector<SortKey> keys(count);
+			for (SortKey& key : keys)
+			{
+				key = {layer(generator), isTranslucent(generator), shader(generator), material(generator), mesh(generator),
+				       depth(generator)};
+			}
+
+			return keys;
+		}
+
+		// A key and the index of what it's for, as the render queue sorts.
+		struct KeyedIndex
+		{
+			std::uint64_t Key;
+			std::uint32_t Index;
+		};
+
+		std::vector<KeyedIndex> RandomKeyedIndices(std::size_t count)
+		{
+			const std::vector<SortKey> keys = RandomKeys(count);
+			std::vector<KeyedIndex> keyed(count);
+			for (std::uint32_t i = 0; i < count; ++i) { keyed[i] = {keys[i].Pack(), i}; }
+			return keyed;
+		}
+	}
+
+	// Two hundred thousand sort keys, the way the render queue sorts them.
+	void SortKeysRadix(benchmark::State& state)
+	{
+		const std::vector<KeyedIndex> unsorted = RandomKeyedIndices(200'000);
+		std::vector<KeyedIndex> keys(unsorted.size());
+		std::vector<KeyedIndex> scratch(unsorted.size());
+		for (auto _ : state)
+		{
+			std::ranges::copy(unsorted, keys.begin());
+			RadixSort(std::span{keys}, std::span{scratch}, [](const KeyedIndex& key) { return key.Key; });
+			benchmark::DoNotOptimize(keys.data());
+		}
+
+		state.SetItemsProcessed(state.iterations() * unsorted.size());
+	}
+
+	BENCHMARK(SortKeysRadix);
+
+	// The same, with the standard library's stable sort, as draws with equal keys keep the order they were submitted.
+	void SortKeysStableSort(benchmark::State& state)
+	{
+		const std::vector<KeyedIndex> unsorted = RandomKeyedIndices(200'000);
+		std::vector<KeyedIndex> keys(unsorted.size());
+		for (auto _ : state)
+		{
+			std::ranges::copy(unsorted, keys.begin());
+			std::ranges::stable_sort(keys, {}, &KeyedIndex::Key);
+			benchmark::DoNotOptimize(keys.data());
+		}
+
+		state.SetItemsProcessed(state.iterations() * unsorted.size());
+	}
+
+	BENCHMARK(SortKeysStableSort);
+
+	// A hundred thousand objects submitted in no particular order, then sorted and batched.
+	void DrawBatcherBuild(benchmark::State& state)
+	{
+		std::mt19937 generator{1};
+		std::uniform_real_distribution<float> position{-100.f, 100.f};
+
+		const std::vector<SortKey> keys = RandomKeys(100'000);
+		std::vector<Matrix<4>> transforms(keys.size());
+		for (Matrix<4>& transform : transforms)
+		{
+			transform = Matrix<4>::Translation(position(generator), position(generator), position(generator));
+		}
+
+		DrawBatcher batcher;
+		for (auto _ : state)
+		{
+			for (std::size_t i = 0; i < keys.size(); ++i) { batcher.Submit(keys[i], transforms[i]); }
+			batcher.Build();
+			benchmark::DoNotOptimize(batcher.GetBatches().data());
+			batcher.Clear();
+		}
+
+		state.SetItemsProcessed(state.iterations() * keys.size());
+	}
+
+	BENCHMARK(DrawBatcherBuild);
+}
@@ -0,0 +1,72 @@
+#include "../../src/Scene/TransformHierarchy.h"
+#include <benchmark/benchmark.h>
+#include <random>
+
+namespace Engine3
+{
+	namespace
+	{
+		// A wide, shallow tree, each node's parent is picked at random from those before it.
+		TransformHierarchy RandomHierarchy(std::size_t count)
+		{
+			std::mt19937 generator{1};
+			std::uniform_real_distribution<float> distribution{-10.f, 10.f};
+
+			TransformHierarchy hierarchy;
+			hierarchy.Reserve(count);
+			hierarchy.Add();
+			for (std::size_t i = 1; i < count; ++i)
+			{
+				const LocalTransform local{
+					{distribution(generator), distribution(generator), distribution(generator)},
+					Quaternion<float>::FromAxisAngle({0.f, 1.f, 0.f}, distribution(generator))
+				};
+
+				const auto last = static_cast<TransformHierarchy::Index>(i - 1);
+				hierarchy.Add(local, std::uniform_int_distribution<TransformHierarchy::Index>{0, last}(generator));
+			}
+
+			hierarchy.Update();
+			return hierarchy;
+		}
+	}
+
+	// Every node recomputed, as a hierarchy without dirty flags would each frame.
+	void TransformHierarchyUpdateAll(benchmark::State& state)
+	{
+		TransformHierarchy hierarchy = RandomHierarchy(state.range(0));
+		for (auto _ : state)
+		{
+			for (TransformHierarchy::Index i = 0; i < hierarchy.Size(); ++i)
+			{
+				hierarchy.SetTranslation(i, hierarchy.GetLocal(i).Translation);
+			}
+
+			hierarchy.Update();
+			benchmark::DoNotOptimize(hierarchy.GetWorldMatrices().data());
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	// A small fraction of leaves moving each frame, the common case.
+	void TransformHierarchyUpdateFew(benchmark::State& state)
+	{
+		TransformHierarchy hierarchy = RandomHierarchy(state.range(0));
+		for (auto _ : state)
+		{
+			for (TransformHierarchy::Index i = hierarchy.Size() - 1; i >= hierarchy.Size() - hierarchy.Size() / 100; --i)
+			{
+				hierarchy.SetTranslation(i, hierarchy.GetLocal(i).Translation);
+			}
+
+			hierarchy.Update();
+			benchmark::DoNotOptimize(hierarchy.GetWorldMatrices().data());
+		}
+
+		state.SetItemsProcessed(state.iterations() * state.range(0));
+	}
+
+	BENCHMARK(TransformHierarchyUpdateAll)->Arg(50'000);
+	BENCHMARK(TransformHierarchyUpdateFew)->Arg(50'000);
+}
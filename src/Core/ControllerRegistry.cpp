@@ -0,0 +1,102 @@
+#include "ControllerRegistry.h"
+#include <bit>
+#include <cassert>
+#include <utility>
+
+std::size_t Engine3::ControllerRegistry::Home(std::int32_t instanceID) const
+{
+	// Fibonacci hashing, instance IDs count up so taking the low bits alone would be fine until they're reused.
+	const std::uint64_t hash = static_cast<std::uint64_t>(instanceID) * 0x9E3779B97F4A7C15ull;
+	return static_cast<std::size_t>(hash >> (64 - std::countr_zero(Slots.size())));
+}
+
+std::size_t Engine3::ControllerRegistry::Find(std::int32_t instanceID) const
+{
+	if (instanceID < 0) { return Slots.size(); }
+
+	const std::size_t mask = Slots.size() - 1;
+	for (std::size_t slot = Home(instanceID); ; slot = (slot + 1) & mask)
+	{
+		if (Slots[slot].InstanceID == instanceID) { return slot; }
+		if (Slots[slot].InstanceID == Empty) { return Slots.size(); }
+	}
+}
+
+void Engine3::ControllerRegistry::Grow()
+{
+	std::vector<Slot> old = std::exchange(Slots, std::vector<Slot>(Slots.size() * 2));
+	const std::size_t mask = Slots.size() - 1;
+	for (const Slot& slot : old)
+	{
+		if (slot.InstanceID == Empty) { continue; }
+
+		std::size_t index = Home(slot.InstanceID);
+		while (Slots[index].InstanceID != Empty) { index = (index + 1) & mask; }
+		Slots[index] = slot;
+	}
+}
+
+std::int32_t Engine3::ControllerRegistry::Add(std::int32_t instanceID, SDL_GameController* controller)
+{
+	assert(instanceID >= 0);
+
+	if (const std::size_t existing = Find(instanceID); existing != Slots.size())
+	{
+		Slots[existing].Controller = controller;
+		return Slots[existing].Player;
+	}
+
+	if ((Count + 1) * 2 > Slots.size()) { Grow(); }
+
+	const int free = std::countr_one(Players);
+	const std::int32_t player = free < MaximumPlayers ? free : NoPlayer;
+	if (player != NoPlayer) { Players |= std::uint64_t{1} << player; }
+
+	const std::size_t mask = Slots.size() - 1;
+	std::size_t index = Home(instanceID);
+	while (Slots[index].InstanceID != Empty) { index = (index + 1) & mask; }
+	Slots[index] = {instanceID, player, controller};
+	++Count;
+
+	return player;
+}
+
+SDL_GameController* Engine3::ControllerRegistry::Remove(std::int32_t instanceID)
+{
+	std::size_t hole = Find(instanceID);
+	if (hole == Slots.size()) { return nullptr; }
+
+	SDL_GameController* controller = Slots[hole].Controller;
+	if (Slots[hole].Player != NoPlayer) { Players &= ~(std::uint64_t{1} << Slots[hole].Player); }
+	--Count;
+
+	// Backward shift deletion, moving later entries of the probe sequence into the hole rather than leaving a
+	// tombstone, so lookups never have to probe past removed controllers.
+	const std::size_t mask = Slots.size() - 1;
+	for (std::size_t slot = (hole + 1) & mask; Slots[slot].InstanceID != Empty; slot = (slot + 1) & mask)
+	{
+		// An entry can only move back to the hole if the hole is between its home and where it is now.
+		const std::size_t home = Home(Slots[slot].InstanceID);
+		const bool canMove = ((slot - home) & mask) >= ((slot - hole) & mask);
+		if (canMove)
+		{
+			Slots[hole] = Slots[slot];
+			hole = slot;
+		}
+	}
+
+	Slots[hole] = {};
+	return controller;
+}
+
+std::int32_t Engine3::ControllerRegistry::GetPlayer(std::int32_t instanceID) const
+{
+	const std::size_t slot = Find(instanceID);
+	return slot == Slots.size() ? NoPlayer : Slots[slot].Player;
+}
+
+SDL_GameController* Engine3::ControllerRegistry::Get(std::int32_t instanceID) const
+{
+	const std::size_t slot = Find(instanceID);
+	return slot == Slots.size() ? nullptr : Slots[slot].Controller;
+}
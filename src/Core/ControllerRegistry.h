@@ -0,0 +1,80 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct _SDL_GameController;
+
+typedef struct _SDL_GameController SDL_GameController;
+
+namespace Engine3
+{
+	/// The open controllers, keyed by their joystick instance ID, each with a player index. \n
+	/// Looking a controller up is a probe into an open addressed hash table rather than a search of every controller,
+	/// as every controller event is looked up and axes can send a thousand a second each. The instance ID is cached
+	/// when added, rather than asked of SDL on every lookup. \n
+	/// It doesn't open or close controllers, so it doesn't depend on SDL.
+	class ControllerRegistry
+	{
+	public:
+		/// The player index of a controller that isn't registered, or when every index is taken.
+		static constexpr std::int32_t NoPlayer = -1;
+
+		/// The most controllers given a player index.
+		static constexpr std::int32_t MaximumPlayers = 64;
+
+	private:
+		// Instance IDs are never negative, so a negative one marks an empty slot.
+		static constexpr std::int32_t Empty = -1;
+
+		struct Slot
+		{
+			std::int32_t InstanceID = Empty;
+			std::int32_t Player = NoPlayer;
+			SDL_GameController* Controller = nullptr;
+		};
+
+		// A power of two in size, kept at most half full so probes stay short.
+		std::vector<Slot> Slots = std::vector<Slot>(8);
+
+		std::size_t Count = 0;
+
+		// Bit i is set while player index i is taken.
+		std::uint64_t Players = 0;
+
+		std::size_t Home(std::int32_t instanceID) const;
+
+		std::size_t Find(std::int32_t instanceID) const;
+
+		void Grow();
+
+	public:
+		/* METHODS */
+		/// Registers \p controller, giving it the lowest player index that's free.
+		/// @return Its player index, or NoPlayer if every index is taken, in which case it's still registered.
+		std::int32_t Add(std::int32_t instanceID, SDL_GameController* controller);
+
+		/// @return The controller that was registered, or null if it wasn't, so it can be closed.
+		SDL_GameController* Remove(std::int32_t instanceID);
+
+		bool Contains(std::int32_t instanceID) const { return Find(instanceID) != Slots.size(); }
+
+		/// @return The controller's player index, or NoPlayer if it isn't registered.
+		std::int32_t GetPlayer(std::int32_t instanceID) const;
+
+		/// @return The controller, or null if it isn't registered.
+		SDL_GameController* Get(std::int32_t instanceID) const;
+
+		std::size_t Size() const { return Count; }
+
+		/// Calls \p function with every registered controller, in no particular order.
+		template <class Function>
+		void ForEach(Function&& function) const
+		{
+			for (const Slot& slot : Slots)
+			{
+				if (slot.InstanceID != Empty) { function(slot.InstanceID, slot.Player, slot.Controller); }
+			}
+		}
+	};
+}
@@ -13,8 +13,6 @@ Engine3::Engine::Engine()
 		assert(false);
 	}
 
-	SDL_GL_SetSwapInterval(1);
-
 	// Set OpenGL version. This should be done before creating an OpenGL window.
 	if (SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3) != 0)
 	{
@@ -48,6 +46,13 @@ Engine3::Engine::Engine()
 
 Engine3::Engine::~Engine() { SDL_Quit(); }
 
-void Engine3::Engine::Update() {}
+void Engine3::Engine::Update()
+{
+	Clock.Tick();
+	while (Clock.ConsumeStep())
+	{
+		if (FixedUpdate) { FixedUpdate(Clock.GetFixedDeltaTime()); }
+	}
+}
 
 Engine3::Engine::operator bool() const { return IsInitialised; }
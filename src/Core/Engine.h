@@ -1,13 +1,21 @@
 #pragma once
+#include "FrameClock.h"
+#include "../Jobs/JobSystem.h"
+#include <functional>
+
 namespace Engine3
 {
 	class Engine
 	{
 	private:
-		float deltaTime = 0;
-
 		bool IsInitialised = true;
 
+		FrameClock Clock;
+
+		std::function<void(float)> FixedUpdate;
+
+		JobSystem Jobs;
+
 	public:
 		Engine();
 
@@ -21,8 +29,17 @@ namespace Engine3
 
 		Engine& operator=(Engine&& other) noexcept = delete;
 
+		/// Starts a new frame, running the fixed update for every timestep that has built up since the last one.
 		void Update();
 
+		/// @param fixedUpdate Called with the fixed timestep in seconds, zero or more times a frame.
+		void SetFixedUpdate(std::function<void(float)> fixedUpdate) { FixedUpdate = std::move(fixedUpdate); }
+
+		FrameClock& GetClock() { return Clock; }
+
+		/// Shared by everything that wants to spread work across threads, rather than each creating its own.
+		JobSystem& GetJobs() { return Jobs; }
+
 		explicit operator bool() const;
 	};
 }
@@ -1,36 +1,35 @@
 #include "Events.h"
-#include "Renderer.h"
-#include "Window.h"
+#include "InputSampler.h"
 #include "../Input/Action.h"
 #include "../Input/InputManager.h"
+#include "../Input/InputRecord.h"
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <functional>
+#include <print>
 #include <SDL.h>
 
-namespace
+Engine3::Events::Events() : Buffer(BatchSize) {}
+
+// Input from a controller without a player index can then still trigger inputs bound for any player.
+static_assert(Engine3::ControllerRegistry::NoPlayer == Engine3::Input::AnyPlayer);
+
+Engine3::Events::~Events()
 {
-	Engine3::Input::Mouse GetMouseButtonName(const SDL_Event& event)
+	Controllers.ForEach([](std::int32_t, std::int32_t, SDL_GameController* controller)
 	{
-		switch (event.button.button)
-		{
-		case SDL_BUTTON_LEFT:
-			return Engine3::Input::Mouse::Left;
-		case SDL_BUTTON_MIDDLE:
-			return Engine3::Input::Mouse::Middle;
-		case SDL_BUTTON_RIGHT:
-			return Engine3::Input::Mouse::Right;
-		case SDL_BUTTON_X1:
-			return Engine3::Input::Mouse::Extra1;
-		case SDL_BUTTON_X2:
-			return Engine3::Input::Mouse::Extra2;
-		default:
-			std::unreachable();
-		}
-	}
+		SDL_GameControllerClose(controller);
+	});
 }
 
-bool Engine3::Events::Process(Window& window, Renderer& renderer, InputManager& inputManager)
+bool Engine3::Events::IsFromOpenDevice(const InputRecord& record) const
+{
+	return record.Device == InputRecord::NoDevice || Controllers.Contains(record.Device);
+}
+
+bool Engine3::Events::Handle(const SDL_Event& event, InputManager& inputManager)
 {
-	SDL_Event event;
-	SDL_PollEvent(&event);
 	switch (event.type) // SDL_EventType
 	{
 	case SDL_QUIT:
@@ -42,94 +41,265 @@ bool Engine3::Events::Process(Window& window, Renderer& renderer, InputManager&
 		// unlike with SDL_WINDOWEVENT_RESIZED.
 		case SDL_WINDOWEVENT_SIZE_CHANGED:
 			{
-				renderer.SetSize(windowEvent.data1, windowEvent.data2);
+				if (ResizeCallback) { ResizeCallback(windowEvent.data1, windowEvent.data2); }
 				break;
 			}
 		default: break;
 		}
 		break;
-	case SDL_KEYDOWN:
-		inputManager.Update(event.key.keysym.scancode, ProcessState::Continuous, {});
-		break;
-	case SDL_KEYUP:
-		inputManager.Update(event.key.keysym.scancode, ProcessState::Release, {});
-		break;
-	case SDL_MOUSEMOTION:
-		inputManager.Update(Input::Mouse::MouseAxisX, ProcessState::Once, static_cast<float>(event.motion.xrel));
-		inputManager.Update(Input::Mouse::MouseAxisY, ProcessState::Once, static_cast<float>(event.motion.yrel));
-		break;
-	case SDL_MOUSEBUTTONDOWN:
-		inputManager.Update(GetMouseButtonName(event),
-		                    ProcessState::Continuous,
-		                    Vector<2>{static_cast<float>(event.button.x), static_cast<float>(event.button.y)});
-		break;
-	case SDL_MOUSEBUTTONUP:
-		inputManager.Update(GetMouseButtonName(event),
-		                    ProcessState::Release,
-		                    Vector<2>{static_cast<float>(event.button.x), static_cast<float>(event.button.y)});
-		break;
-	case SDL_MOUSEWHEEL:
-		inputManager.Update(Input::Mouse::MouseWheelX, ProcessState::Once, event.wheel.preciseX);
-		inputManager.Update(Input::Mouse::MouseWheelY, ProcessState::Once, event.wheel.preciseY);
-		break;
 	case SDL_CONTROLLERDEVICEADDED:
+		// Added is the only controller event whose which is a device index rather than an instance ID.
 		if (SDL_GameController* controller = SDL_GameControllerOpen(event.cdevice.which))
 		{
-			Controllers.emplace_back(controller, SDL_GameControllerClose);
+			const SDL_JoystickID instanceID = SDL_JoystickInstanceID(SDL_GameControllerGetJoystick(controller));
+			if (Controllers.Contains(instanceID))
+			{
+				// Opening it again only added a reference.
+				SDL_GameControllerClose(controller);
+				break;
+			}
+
+			SDL_GameControllerSetPlayerIndex(controller, Controllers.Add(instanceID, controller));
 		}
 		break;
 	case SDL_CONTROLLERDEVICEREMOVED:
-		std::erase_if(Controllers,
-		              [&event](const auto& controller)
-		              {
-			              return event.cdevice.which == SDL_JoystickInstanceID(
-				              SDL_GameControllerGetJoystick(controller.get()));
-		              }
-		);
+		if (SDL_GameController* controller = Controllers.Remove(event.cdevice.which))
+		{
+			SDL_GameControllerClose(controller);
+		}
+		std::erase_if(AxisMotions, [&event](const AxisMotion& motion)
+		{
+			return motion.Controller == event.cdevice.which;
+		});
+		RemoveSticks(event.cdevice.which);
 		break;
-	case SDL_CONTROLLERBUTTONDOWN:
-		for (auto& controller : Controllers)
+	default:
 		{
-			if (event.cbutton.which == SDL_JoystickInstanceID(SDL_GameControllerGetJoystick(controller.get())))
+			std::array<InputRecord, InputRecord::MaximumPerEvent> records;
+			const std::size_t count = InputRecord::FromEvent(event, records);
+			for (std::size_t i = 0; i < count; ++i)
 			{
-				inputManager.Update(
-					static_cast<SDL_GameControllerButton>(event.cbutton.button),
-					ProcessState::Continuous,
-					{});
+				if (IsFromOpenDevice(records[i])) { Dispatch(records[i], inputManager); }
 			}
+			break;
 		}
+	}
 
-		break;
-	case SDL_CONTROLLERBUTTONUP:
-		for (auto& controller : Controllers)
+	return true;
+}
+
+void Engine3::Events::Dispatch(InputRecord record, InputManager& inputManager)
+{
+	// Replayed records already have the player, as the controllers aren't open.
+	if (record.Player == Input::AnyPlayer) { record.Player = Controllers.GetPlayer(record.Device); }
+
+	if (InputCallback) { InputCallback(record); }
+
+	if (const Input::Mouse* mouse = std::get_if<Input::Mouse>(&record.Input))
+	{
+		switch (*mouse)
 		{
-			if (event.cbutton.which == SDL_JoystickInstanceID(SDL_GameControllerGetJoystick(controller.get())))
-			{
-				inputManager.Update(
-					static_cast<SDL_GameControllerAxis>(event.caxis.axis),
-					ProcessState::Release,
-					{});
-			}
+		case Input::Mouse::MouseAxisX:
+			MouseMotionX += std::get<float>(record.Value);
+			HasMouseMotion = true;
+			return;
+		case Input::Mouse::MouseAxisY:
+			MouseMotionY += std::get<float>(record.Value);
+			HasMouseMotion = true;
+			return;
+		case Input::Mouse::MouseWheelX:
+			MouseWheelX += std::get<float>(record.Value);
+			HasMouseWheel = true;
+			return;
+		case Input::Mouse::MouseWheelY:
+			MouseWheelY += std::get<float>(record.Value);
+			HasMouseWheel = true;
+			return;
+		default: break;
 		}
-		break;
-	case SDL_CONTROLLERAXISMOTION:
-		for (auto& controller : Controllers)
+	}
+	else if (const SDL_GameControllerAxis* axis = std::get_if<SDL_GameControllerAxis>(&record.Input))
+	{
+		const float value = std::get<float>(record.Value);
+		if (*axis <= SDL_CONTROLLER_AXIS_RIGHTY)
 		{
-			if (event.cbutton.which == SDL_JoystickInstanceID(SDL_GameControllerGetJoystick(controller.get())))
-			{
-				float value = event.caxis.value < 0
-					              ? -static_cast<float>(event.caxis.value) / std::numeric_limits<Sint16>::min()
-					              : static_cast<float>(event.caxis.value) / std::numeric_limits<Sint16>::max();
-				inputManager.Update(
-					static_cast<SDL_GameControllerAxis>(event.caxis.axis),
-					ProcessState::Continuous,
-					value);
-			}
+			MoveStick(record.Device, record.Player, static_cast<std::uint8_t>(*axis), value);
 		}
-		break;
-	default: break;
+
+		// Sticks are usually bound as a whole, so their axes are only coalesced on their own when bound on their own.
+		if (!inputManager.IsBound(*axis)) { return; }
+
+		auto motion = std::ranges::find_if(AxisMotions, [&record, axis](const AxisMotion& motion)
+		{
+			return motion.Controller == record.Device && motion.Axis == *axis;
+		});
+
+		if (motion == AxisMotions.end())
+		{
+			AxisMotions.push_back({record.Device, record.Player, static_cast<std::uint8_t>(*axis), value});
+		}
+		else { motion->Value = value; }
+		return;
+	}
+
+	inputManager.Update(record.Input, record.State, record.Value, record.Player);
+}
+
+void Engine3::Events::MoveStick(std::int32_t controller, std::int32_t player, std::uint8_t axis, float value)
+{
+	auto found = std::ranges::find(StickControllers, controller);
+	if (found == StickControllers.end())
+	{
+		found = StickControllers.insert(found, controller);
+		StickPlayers.push_back(player);
+		for (std::vector<float>* positions : {&StickX, &StickY}) { positions->resize(positions->size() + 2, 0.f); }
+		HasStickMoved.resize(HasStickMoved.size() + 2, false);
 	}
 
+	const bool isRight = axis == SDL_CONTROLLER_AXIS_RIGHTX || axis == SDL_CONTROLLER_AXIS_RIGHTY;
+	const bool isX = axis == SDL_CONTROLLER_AXIS_LEFTX || axis == SDL_CONTROLLER_AXIS_RIGHTX;
+	const std::size_t stick = (found - StickControllers.begin()) * 2 + isRight;
+
+	(isX ? StickX : StickY)[stick] = value;
+	HasStickMoved[stick] = true;
+}
+
+void Engine3::Events::RemoveSticks(std::int32_t controller)
+{
+	const auto found = std::ranges::find(StickControllers, controller);
+	if (found == StickControllers.end()) { return; }
+
+	const std::ptrdiff_t stick = (found - StickControllers.begin()) * 2;
+	StickPlayers.erase(StickPlayers.begin() + stick / 2);
+	StickControllers.erase(found);
+	for (std::vector<float>* positions : {&StickX, &StickY})
+	{
+		positions->erase(positions->begin() + stick, positions->begin() + stick + 2);
+	}
+	HasStickMoved.erase(HasStickMoved.begin() + stick, HasStickMoved.begin() + stick + 2);
+}
+
+void Engine3::Events::DispatchSticks(InputManager& inputManager)
+{
+	if (std::ranges::none_of(HasStickMoved, std::identity{})) { return; }
+
+	const std::array isBound{
+		inputManager.IsBound(Input::GamepadStick::Left), inputManager.IsBound(Input::GamepadStick::Right)
+	};
+	if (isBound[0] || isBound[1])
+	{
+		ZonedStickX.assign(StickX.begin(), StickX.end());
+		ZonedStickY.assign(StickY.begin(), StickY.end());
+		StickDeadZone(ZonedStickX, ZonedStickY);
+
+		for (std::size_t stick = 0; stick < HasStickMoved.size(); ++stick)
+		{
+			if (!HasStickMoved[stick] || !isBound[stick % 2]) { continue; }
+
+			inputManager.Update(static_cast<Input::GamepadStick>(stick % 2), ProcessState::Continuous,
+			                    Vector<2>{ZonedStickX[stick], ZonedStickY[stick]}, StickPlayers[stick / 2]);
+		}
+	}
+
+	std::ranges::fill(HasStickMoved, false);
+}
+
+void Engine3::Events::DispatchCoalesced(InputManager& inputManager)
+{
+	if (HasMouseMotion)
+	{
+		inputManager.Update(Input::Mouse::MouseAxisX, ProcessState::Once, MouseMotionX);
+		inputManager.Update(Input::Mouse::MouseAxisY, ProcessState::Once, MouseMotionY);
+		MouseMotionX = MouseMotionY = 0;
+		HasMouseMotion = false;
+	}
+
+	if (HasMouseWheel)
+	{
+		inputManager.Update(Input::Mouse::MouseWheelX, ProcessState::Once, MouseWheelX);
+		inputManager.Update(Input::Mouse::MouseWheelY, ProcessState::Once, MouseWheelY);
+		MouseWheelX = MouseWheelY = 0;
+		HasMouseWheel = false;
+	}
+
+	for (const AxisMotion& motion : AxisMotions)
+	{
+		inputManager.Update(static_cast<SDL_GameControllerAxis>(motion.Axis), ProcessState::Continuous, motion.Value,
+		                    motion.Player);
+	}
+	AxisMotions.clear();
+
+	DispatchSticks(inputManager);
+}
+
+bool Engine3::Events::Process(InputManager& inputManager)
+{
+	// Peeking doesn't pump, unlike polling, so the operating system's events need moving into SDL's queue first.
+	SDL_PumpEvents();
+
+	bool isRunning = true;
+	int count;
+	do
+	{
+		count = SDL_PeepEvents(Buffer.data(), static_cast<int>(Buffer.size()), SDL_GETEVENT, SDL_FIRSTEVENT,
+		                       SDL_LASTEVENT);
+		if (count < 0)
+		{
+			std::print("{}\n", SDL_GetError());
+			assert(false);
+			break;
+		}
+
+		// Every event is still handled after a quit, so none are lost if quitting is cancelled.
+		for (int i = 0; i < count; ++i) { isRunning &= Handle(Buffer[i], inputManager); }
+	}
+	while (count == static_cast<int>(Buffer.size()));
+
+	DispatchCoalesced(inputManager);
+	inputManager.Process();
+
+	return isRunning;
+}
+
+bool Engine3::Events::Process(InputManager& inputManager, InputSampler& inputSampler)
+{
+	// Sampled straight after pumping, rather than left for a sampling thread, so input isn't a frame late.
+	if (inputSampler.GetPumping() == InputSampler::Pumping::MainThread)
+	{
+		SDL_PumpEvents();
+		inputSampler.Sample();
+	}
+
+	// A sampling thread carries on while they're drained, so only what's waiting now is taken. The records are counted
+	// before the events, so every event sampled before one of them is counted too. Those events are then handled
+	// first, so a controller is opened before any input from it, even if it was added after draining began.
+	const std::size_t recordCount = inputSampler.GetRecordCount();
+	const std::size_t eventCount = inputSampler.GetEventCount();
+
+	bool isRunning = true;
+	SDL_Event event;
+	for (std::size_t i = 0; i < eventCount && inputSampler.TryPopEvent(event); ++i)
+	{
+		isRunning &= Handle(event, inputManager);
+	}
+
+	InputRecord record;
+	for (std::size_t i = 0; i < recordCount && inputSampler.TryPop(record); ++i)
+	{
+		if (IsFromOpenDevice(record)) { Dispatch(record, inputManager); }
+	}
+
+	DispatchCoalesced(inputManager);
+	inputManager.Process();
+
+	return isRunning;
+}
+
+void Engine3::Events::Replay(InputManager& inputManager, std::span<const InputRecord> records)
+{
+	// Controllers aren't opened when replaying, so records aren't checked against them.
+	for (const InputRecord& record : records) { Dispatch(record, inputManager); }
+
+	DispatchCoalesced(inputManager);
 	inputManager.Process();
-	return true;
 }
@@ -1,26 +1,120 @@
 #pragma once
-#include <memory>
+#include "ControllerRegistry.h"
+#include "../Input/DeadZone.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <utility>
 #include <vector>
 
 union SDL_Event;
 
-struct _SDL_GameController;
-
-typedef struct _SDL_GameController SDL_GameController;
-
 namespace Engine3
 {
-	class Renderer;
+	class InputManager;
 
-	class Window;
+	class InputSampler;
 
-	class InputManager;
+	struct InputRecord;
 
+	/// Drains SDL's event queue once a frame, forwarding input to an InputManager.
 	class Events
 	{
-		std::vector<std::unique_ptr<SDL_GameController, void(*)(SDL_GameController*)>> Controllers;
+	public:
+		/// The most events copied out of SDL's queue at once, it's drained in as many batches as it takes.
+		static constexpr std::size_t BatchSize = 128;
+
+	private:
+		struct AxisMotion
+		{
+			std::int32_t Controller;
+			std::int32_t Player;
+			std::uint8_t Axis;
+			float Value;
+		};
+
+		ControllerRegistry Controllers;
+
+		std::function<void(int, int)> ResizeCallback;
+
+		std::function<void(const InputRecord&)> InputCallback;
+
+		// Allocated once up front, rather than every frame. SDL_Event is incomplete here so it can't be an array.
+		std::vector<SDL_Event> Buffer;
+
+		// A burst of motion events is coalesced so each input is updated once a frame, rather than once per event, which
+		// would also leave only the last event's value as they overwrite each other. Relative motion is summed, whereas
+		// only the last position of each axis is kept.
+		float MouseMotionX = 0;
+		float MouseMotionY = 0;
+		float MouseWheelX = 0;
+		float MouseWheelY = 0;
+		bool HasMouseMotion = false;
+		bool HasMouseWheel = false;
+		std::vector<AxisMotion> AxisMotions;
+
+		// The latest position of both sticks of every controller that's moved one, as a structure of arrays so the dead
+		// zone is applied to all of them in one pass. Sticks 2i and 2i + 1 are the left and right of StickControllers[i],
+		// whose player is StickPlayers[i].
+		std::vector<std::int32_t> StickControllers;
+		std::vector<std::int32_t> StickPlayers;
+		std::vector<float> StickX;
+		std::vector<float> StickY;
+		std::vector<std::uint8_t> HasStickMoved;
+
+		// The positions after the dead zone, kept apart so the latest raw position of each axis is kept.
+		std::vector<float> ZonedStickX;
+		std::vector<float> ZonedStickY;
+
+		DeadZone StickDeadZone;
+
+		bool IsFromOpenDevice(const InputRecord& record) const;
+
+		/// @return False if the event was a request to quit.
+		bool Handle(const SDL_Event& event, InputManager& inputManager);
+
+		void Dispatch(InputRecord record, InputManager& inputManager);
+
+		void MoveStick(std::int32_t controller, std::int32_t player, std::uint8_t axis, float value);
+
+		void RemoveSticks(std::int32_t controller);
+
+		void DispatchSticks(InputManager& inputManager);
+
+		void DispatchCoalesced(InputManager& inputManager);
 
 	public:
-		bool Process(Window&, Renderer&, InputManager&);
+		/* CONSTRUCTORS */
+		Events();
+
+		~Events();
+
+		/* METHODS */
+		/// @param callback Called with the new width and height whenever the window changes size.
+		void SetResizeCallback(std::function<void(int, int)> callback) { ResizeCallback = std::move(callback); }
+
+		/// @return The open controllers, and the player index each was given.
+		const ControllerRegistry& GetControllers() const { return Controllers; }
+
+		/// Sets the dead zone applied to Input::GamepadStick, which defaults to DeadZone's defaults.
+		void SetStickDeadZone(const DeadZone& deadZone) { StickDeadZone = deadZone; }
+
+		/// @param callback Called with every input as it's handled, before it's coalesced, so the time each was sampled
+		/// at can be acted upon.
+		void SetInputCallback(std::function<void(const InputRecord&)> callback) { InputCallback = std::move(callback); }
+
+		/// Handles every pending event, then processes each action once.
+		/// @return False once the application has been asked to quit.
+		bool Process(InputManager& inputManager);
+
+		/// Handles every event \p inputSampler has taken since the last call, then processes each action once. \n
+		/// Pumps SDL's events and samples them first if that's left to the main thread.
+		/// @return False once the application has been asked to quit.
+		bool Process(InputManager& inputManager, InputSampler& inputSampler);
+
+		/// Handles \p records exactly as Process would have when they were recorded, then processes each action once,
+		/// without touching SDL.
+		void Replay(InputManager& inputManager, std::span<const InputRecord> records);
 	};
 }
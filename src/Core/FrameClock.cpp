@@ -0,0 +1,84 @@
+#include "FrameClock.h"
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+#include <thread>
+
+Engine3::FrameClock::FrameClock(Duration fixedTimestep) { SetFixedTimestep(fixedTimestep); }
+
+void Engine3::FrameClock::WaitForTargetFrameTime() const
+{
+	const Clock::time_point target = PreviousFrame + TargetFrameTime;
+
+	// Sleeping can overshoot by a scheduler quantum, so sleep for most of the wait and yield for the rest.
+	constexpr Duration sleepMargin = std::chrono::milliseconds{2};
+	if (Clock::now() + sleepMargin < target) { std::this_thread::sleep_until(target - sleepMargin); }
+	while (Clock::now() < target) { std::this_thread::yield(); }
+}
+
+void Engine3::FrameClock::Tick()
+{
+	if (TargetFrameTime > Duration::zero()) { WaitForTargetFrameTime(); }
+
+	const Clock::time_point now = Clock::now();
+	const Duration elapsed = now - PreviousFrame;
+	PreviousFrame = now;
+
+	Advance(elapsed);
+}
+
+void Engine3::FrameClock::Advance(Duration elapsed)
+{
+	assert(elapsed >= Duration::zero());
+
+	FrameTime = elapsed;
+	Accumulator += std::min(elapsed, MaximumFrameTime);
+
+	History[HistoryNext] = elapsed;
+	HistoryNext = (HistoryNext + 1) % HistorySize;
+	HistoryCount = std::min(HistoryCount + 1, HistorySize);
+}
+
+bool Engine3::FrameClock::ConsumeStep()
+{
+	if (Accumulator < FixedTimestep) { return false; }
+
+	Accumulator -= FixedTimestep;
+	return true;
+}
+
+float Engine3::FrameClock::GetInterpolation() const
+{
+	return std::chrono::duration<float>{Accumulator} / std::chrono::duration<float>{FixedTimestep};
+}
+
+float Engine3::FrameClock::GetDeltaTime() const { return std::chrono::duration<float>{FrameTime}.count(); }
+
+float Engine3::FrameClock::GetFixedDeltaTime() const { return std::chrono::duration<float>{FixedTimestep}.count(); }
+
+void Engine3::FrameClock::SetFixedTimestep(Duration fixedTimestep)
+{
+	assert(fixedTimestep > Duration::zero());
+	FixedTimestep = fixedTimestep;
+}
+
+Engine3::FrameClock::Stats Engine3::FrameClock::GetStats() const
+{
+	if (HistoryCount == 0) { return {}; }
+
+	std::array<Duration, HistorySize> sorted{};
+	const auto begin = sorted.begin();
+	const auto end = std::copy_n(History.begin(), HistoryCount, begin);
+
+	// Nearest rank, so with fewer than a hundred frames it's the slowest one.
+	const std::size_t rank = (HistoryCount * 99 + 99) / 100 - 1;
+	std::nth_element(begin, begin + rank, end);
+
+	Stats stats;
+	stats.Percentile99 = sorted[rank];
+	stats.Minimum = *std::min_element(begin, end);
+	stats.Maximum = *std::max_element(begin, end);
+	stats.Average = std::accumulate(begin, end, Duration::zero()) / static_cast<Duration::rep>(HistoryCount);
+
+	return stats;
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstddef>
+
+namespace Engine3
+{
+	/// Measures frame times, and splits them into fixed timesteps for the simulation. \n
+	/// Each frame call Tick once, then ConsumeStep in a loop to run as many fixed updates as have built up, then render
+	/// using GetInterpolation to blend between the last two simulation states. This keeps the simulation deterministic
+	/// regardless of frame rate, without rendering juddering when the two don't line up.
+	class FrameClock
+	{
+	public:
+		using Clock = std::chrono::steady_clock;
+		using Duration = Clock::duration;
+
+		static constexpr Duration DefaultFixedTimestep = std::chrono::nanoseconds{1'000'000'000 / 60};
+
+		/// Frames longer than this are clamped, so that after a stall, such as a breakpoint or the window being dragged,
+		/// the simulation doesn't try to catch up all at once and fall further behind each frame.
+		static constexpr Duration DefaultMaximumFrameTime = std::chrono::milliseconds{250};
+
+		/// The number of most recent frames the stats are taken over.
+		static constexpr std::size_t HistorySize = 256;
+
+		struct Stats
+		{
+			Duration Minimum{};
+			Duration Average{};
+			Duration Percentile99{};
+			Duration Maximum{};
+		};
+
+	private:
+		Duration FixedTimestep;
+		Duration MaximumFrameTime = DefaultMaximumFrameTime;
+		Duration TargetFrameTime{};
+		Duration Accumulator{};
+		Duration FrameTime{};
+
+		Clock::time_point PreviousFrame = Clock::now();
+
+		std::array<Duration, HistorySize> History{};
+		std::size_t HistoryCount = 0;
+		std::size_t HistoryNext = 0;
+
+		void WaitForTargetFrameTime() const;
+
+	public:
+		/* CONSTRUCTORS */
+		explicit FrameClock(Duration fixedTimestep = DefaultFixedTimestep);
+
+		/* METHODS */
+		/// Starts a new frame, first waiting out the rest of the target frame time if there is one.
+		void Tick();
+
+		/// Starts a new frame that took \p elapsed, without reading the clock.
+		void Advance(Duration elapsed);
+
+		/// Takes one fixed timestep from the time built up, call in a loop until it returns false.
+		/// @return Whether there was enough time built up for another step.
+		bool ConsumeStep();
+
+		/// @return How far between the previous and current simulation states the frame is, from zero to one.
+		float GetInterpolation() const;
+
+		/// @return The duration of the last frame in seconds, unclamped.
+		float GetDeltaTime() const;
+
+		/// @return The fixed timestep in seconds.
+		float GetFixedDeltaTime() const;
+
+		Duration GetFrameTime() const { return FrameTime; }
+
+		void SetFixedTimestep(Duration fixedTimestep);
+
+		void SetMaximumFrameTime(Duration maximumFrameTime) { MaximumFrameTime = maximumFrameTime; }
+
+		/// Paces frames in Tick so they're at least \p targetFrameTime long, without relying on vertical sync. \n
+		/// Zero, the default, disables pacing.
+		void SetTargetFrameTime(Duration targetFrameTime) { TargetFrameTime = targetFrameTime; }
+
+		/// @return Frame time stats over the last HistorySize frames, which are all zero before the first frame.
+		Stats GetStats() const;
+	};
+}
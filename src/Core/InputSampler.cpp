@@ -0,0 +1,70 @@
+#include "InputSampler.h"
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <print>
+#include <SDL.h>
+
+struct Engine3::InputSampler::EventBuffer : RingBuffer<SDL_Event, EventCapacity> {};
+
+Engine3::InputSampler::InputSampler(Pumping pumping, std::chrono::microseconds samplingInterval)
+	: Pump(pumping), SamplingInterval(samplingInterval), OtherEvents(std::make_unique<EventBuffer>())
+{
+	if (Pump == Pumping::SamplingThread) { Thread = std::jthread([this](std::stop_token stopToken) { Run(stopToken); }); }
+}
+
+Engine3::InputSampler::~InputSampler() = default;
+
+void Engine3::InputSampler::Run(std::stop_token stopToken)
+{
+	while (!stopToken.stop_requested())
+	{
+		SDL_PumpEvents();
+		Sample();
+		std::this_thread::sleep_for(SamplingInterval);
+	}
+}
+
+void Engine3::InputSampler::Sample()
+{
+	// Only as many events are taken as are certain to fit, so this never waits on the consumer, which may be the same
+	// thread. The rest are left in SDL's queue for the next sample.
+	std::size_t room = std::min((RecordCapacity - Records.Size()) / InputRecord::MaximumPerEvent,
+	                            EventCapacity - OtherEvents->Size());
+
+	std::array<SDL_Event, 64> events;
+	std::array<InputRecord, InputRecord::MaximumPerEvent> records;
+	while (room > 0)
+	{
+		const int wanted = static_cast<int>(std::min(room, events.size()));
+		const int count = SDL_PeepEvents(events.data(), wanted, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+		if (count < 0)
+		{
+			std::print("{}\n", SDL_GetError());
+			assert(false);
+			return;
+		}
+
+		for (int i = 0; i < count; ++i)
+		{
+			const std::size_t recordCount = InputRecord::FromEvent(events[i], records);
+			if (recordCount == 0) { OtherEvents->TryPush(events[i]); }
+			for (std::size_t record = 0; record < recordCount; ++record) { Records.TryPush(records[record]); }
+		}
+
+		if (count < wanted) { return; }
+		room -= static_cast<std::size_t>(count);
+	}
+}
+
+bool Engine3::InputSampler::TryPopUntil(InputRecord::Clock::time_point time, InputRecord& record)
+{
+	const std::optional<InputRecord> oldest = Records.Peek();
+	if (!oldest || oldest->Timestamp > time) { return false; }
+
+	return Records.TryPop(record);
+}
+
+std::size_t Engine3::InputSampler::GetEventCount() const { return OtherEvents->Size(); }
+
+bool Engine3::InputSampler::TryPopEvent(SDL_Event& event) { return OtherEvents->TryPop(event); }
@@ -0,0 +1,106 @@
+#pragma once
+#include "../Input/InputRecord.h"
+#include "../Utility/RingBuffer.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+namespace Engine3
+{
+	/// Samples input, optionally on its own thread so a slow frame doesn't delay when input is read. Each input keeps
+	/// the time SDL queued it, rather than the frame it was handled in. \n
+	/// Sampling is the only reader of SDL's event queue. Input is converted into records, and every other event is
+	/// passed on untouched, both through lock-free ring buffers that Events::Process drains.
+	class InputSampler
+	{
+	public:
+		/// The most records waiting to be consumed. Events that don't fit are left in SDL's queue until there's room,
+		/// rather than dropped.
+		static constexpr std::size_t RecordCapacity = 4096;
+
+		/// The most events other than input waiting to be consumed.
+		static constexpr std::size_t EventCapacity = 256;
+
+		static constexpr std::chrono::microseconds DefaultSamplingInterval{500};
+
+		/// Which thread moves the operating system's events into SDL's queue.
+		enum class Pumping
+		{
+			/// Each frame, by Events::Process, which then samples straight away on the main thread, so input is handled
+			/// the frame it's pumped in. There's no sampling thread.
+			MainThread,
+			/// As often as the sampler samples. SDL stamps the events it pumps, so they're stamped closer to when they
+			/// happened than once a frame. \n
+			/// SDL only supports pumping on the thread that initialised video, so this must be opted into where the
+			/// platform is known to allow it. Windows delivers messages to the thread that created the window, macOS only
+			/// to the main thread, and X11 and Wayland aren't safe while the main thread renders and swaps.
+			SamplingThread
+		};
+
+		/// Safe on every platform.
+		static constexpr Pumping DefaultPumping() { return Pumping::MainThread; }
+
+	private:
+		Pumping Pump;
+
+		std::chrono::microseconds SamplingInterval;
+
+		RingBuffer<InputRecord, RecordCapacity> Records;
+
+		// A ring buffer of SDL_Event, which isn't complete here.
+		struct EventBuffer;
+		std::unique_ptr<EventBuffer> OtherEvents;
+
+		// Declared last so the thread is joined before anything it uses is destroyed. Only started when it pumps.
+		std::jthread Thread;
+
+		void Run(std::stop_token stopToken);
+
+	public:
+		/* CONSTRUCTORS */
+		/// Starts sampling immediately if it's on its own thread. SDL's event subsystem must already be initialised.
+		explicit InputSampler(Pumping pumping = DefaultPumping(),
+		                      std::chrono::microseconds samplingInterval = DefaultSamplingInterval);
+
+		~InputSampler();
+
+		/* COPY AND MOVE OPERATIONS*/
+		// The thread refers back to the sampler, so it can't be moved.
+		InputSampler(const InputSampler& other) = delete;
+
+		InputSampler(InputSampler&& other) noexcept = delete;
+
+		InputSampler& operator=(const InputSampler& other) = delete;
+
+		InputSampler& operator=(InputSampler&& other) noexcept = delete;
+
+		/* METHODS */
+		Pumping GetPumping() const { return Pump; }
+
+		/// Moves every event waiting in SDL's queue into the buffers, as far as there's room, keeping the time SDL queued
+		/// each. Called by the sampling thread, or by Events::Process with Pumping::MainThread, and must only
+		/// ever be called from one thread.
+		void Sample();
+
+		/// @return How many input records are waiting, which only grows until the consumer takes some.
+		std::size_t GetRecordCount() const { return Records.Size(); }
+
+		/// @return How many events that aren't input are waiting, which only grows until the consumer takes some.
+		std::size_t GetEventCount() const;
+
+		/// Takes the oldest input record, only call from one thread.
+		/// @return False if there are none waiting.
+		bool TryPop(InputRecord& record) { return Records.TryPop(record); }
+
+		/// Takes the oldest input record if it was sampled no later than \p time, so input can be consumed in step with
+		/// a simulation that runs behind real time. Only call from one thread.
+		/// @return False if there are none waiting from before then.
+		bool TryPopUntil(InputRecord::Clock::time_point time, InputRecord& record);
+
+		/// Takes the oldest event that isn't input, only call from one thread.
+		/// @return False if there are none waiting.
+		bool TryPopEvent(SDL_Event& event);
+	};
+}
@@ -1,12 +1,108 @@
 #include "Renderer.h"
 #include "../Maths/Matrix.h"
+#include "../Rendering/RenderBackend.h"
 #include <filesystem>
 #include <fstream>
 #include <print>
 #include <SDL.h>
+#include <span>
 #include <string>
 #include <GL/glew.h>
 
+class Engine3::Renderer::OpenGLBackend final : public RenderBackend
+{
+private:
+	Renderer& Renderer_;
+
+	const Mesh* Mesh_ = nullptr;
+
+	// Where the frame's transforms start in the stream buffer.
+	std::size_t InstanceOffset_ = 0;
+
+public:
+	/* CONSTRUCTORS */
+	explicit OpenGLBackend(Renderer& renderer) : Renderer_(renderer) {}
+
+	/* METHODS */
+	void Begin(std::span<const Matrix<4>> instances) override
+	{
+		// Written straight into this frame's part of the stream buffer, which the GPU is done with. Room is left for
+		// aligning each upload.
+		StreamBuffer& stream = *Renderer_.Stream_;
+		stream.BeginFrame(sizeof(CameraUniforms) + instances.size_bytes() + 2 * UploadRing::MaximumAlignment);
+		const std::size_t cameraOffset = stream.Upload(std::span<const CameraUniforms>{&Renderer_.Camera_, 1},
+		                                               stream.GetUniformAlignment()).value();
+		InstanceOffset_ = stream.Upload(instances).value();
+		stream.Flush();
+
+		glBindBufferRange(GL_UNIFORM_BUFFER, static_cast<GLuint>(UniformBinding::Camera), stream.GetHandle(),
+		                  static_cast<GLintptr>(cameraOffset), sizeof(CameraUniforms));
+		glBindBuffer(GL_ARRAY_BUFFER, stream.GetHandle());
+
+		Renderer_.DrawCallCount_ = 0;
+	}
+
+	void Execute(const DrawCommand&) override
+	{
+		std::print("Error! Draws must be batched before they're replayed!\n");
+		assert(false);
+	}
+
+	void Execute(const SetTranslucentCommand& command) override
+	{
+		if (command.IsTranslucent)
+		{
+			glEnable(GL_BLEND);
+			glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+			glDepthMask(GL_FALSE);
+		}
+		else
+		{
+			glDisable(GL_BLEND);
+			glDepthMask(GL_TRUE);
+		}
+	}
+
+	void Execute(const BindShaderCommand& command) override
+	{
+		glUseProgram(Renderer_.Shaders_[command.Shader].Program);
+	}
+
+	void Execute(const BindMeshCommand& command) override
+	{
+		Mesh_ = &Renderer_.Meshes_[command.Mesh];
+		glBindVertexArray(Mesh_->VertexArray);
+	}
+
+	void Execute(const DrawInstancedCommand& command) override
+	{
+		// Starting from the first instance would need OpenGL 4.2, so the attributes are offset to it instead.
+		// The transform's rows are each a column in GLSL, so it's transposed for the column vectors used there.
+		const std::size_t offset = InstanceOffset_ + command.FirstInstance * sizeof(Matrix<4>);
+		for (GLuint row = 0; row < 4; ++row)
+		{
+			glVertexAttribPointer(TransformAttribute + row, 4, GL_FLOAT, GL_FALSE, sizeof(Matrix<4>),
+			                      reinterpret_cast<void*>(offset + row * 4 * sizeof(float)));
+		}
+
+		glDrawElementsInstanced(GL_TRIANGLES, Mesh_->IndexCount, GL_UNSIGNED_SHORT, nullptr,
+		                        static_cast<GLsizei>(command.InstanceCount));
+		++Renderer_.DrawCallCount_;
+	}
+
+	void End() override
+	{
+		// Left as the rest of the frame expects.
+		glDisable(GL_BLEND);
+		glDepthMask(GL_TRUE);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		glBindVertexArray(0);
+		glUseProgram(0);
+
+		Renderer_.Stream_->EndFrame();
+	}
+};
+
 GLenum Engine3::Renderer::LoadShader(GLenum shaderType, const std::string_view shaderFileName)
 {
 	std::string shaderFileContents;
@@ -91,61 +187,157 @@ GLuint Engine3::Renderer::CreateProgram(const std::vector<GLuint>& shaderList)
 
 void Engine3::Renderer::InitialiseProgram(const int width, const int height)
 {
-	std::vector<GLuint> shaderList;
+	const float near = Near_;
+	const float far = Far_;
+
+	Matrix<4>& perspective = Camera_.Perspective;
+	std::ranges::fill(perspective, 0.f);
+	perspective(0, 0) = FrustumScale_ / (width / static_cast<float>(height));
+	perspective(1, 1) = FrustumScale_;
+	perspective(2, 2) = (far + near) / (near - far);
+	perspective(2, 3) = (2 * far * near) / (near - far);
+	perspective(3, 2) = -1.0f;
+
+	// The first shader and material can't be rejected.
+	AddMaterial(*AddShader("vertex.vert", "fragment.frag"));
+}
+
+void Engine3::Renderer::InitialiseStreamBuffer()
+{
+	// Room for a few thousand instances before it has to grow.
+	Stream_.emplace(4096 * sizeof(Matrix<4>));
+}
+
+void Engine3::Renderer::InitialiseMeshes()
+{
+	// Every position comes before every colour, and each object is half of the vertices, sharing the indices.
+	const std::size_t objectVertices = numberOfVertices / 2;
+	const std::span<const float> positions = std::span{Vertices_}.first(numberOfVertices * 3);
+	const std::span<const float> colours = std::span{Vertices_}.subspan(numberOfVertices * 3);
+
+	AddMesh(positions.first(objectVertices * 3), colours.first(objectVertices * 4), IndexData_);
+	AddMesh(positions.subspan(objectVertices * 3), colours.subspan(objectVertices * 4), IndexData_);
+}
+
+std::optional<Engine3::MeshHandle> Engine3::Renderer::AddMesh(std::span<const float> positions,
+                                                              std::span<const float> colours,
+                                                              std::span<const GLshort> indices)
+{
+	assert(positions.size() / 3 == colours.size() / 4);
 
-	shaderList.push_back(LoadShader(GL_VERTEX_SHADER, "vertex.vert"));
-	shaderList.push_back(LoadShader(GL_FRAGMENT_SHADER, "fragment.frag"));
+	// A handle past what a sort key holds would be cut down, binding the wrong mesh.
+	if (Meshes_.size() == SortKey::MeshCount)
+	{
+		std::print("Error! There can't be more than {} meshes!\n", SortKey::MeshCount);
+		return std::nullopt;
+	}
 
-	ShaderProgram_ = CreateProgram(shaderList);
+	Mesh mesh{};
+	mesh.IndexCount = static_cast<GLsizei>(indices.size());
 
-	OffsetUniform_ = glGetUniformLocation(ShaderProgram_, "offset");
-	PerspectiveMatrixUniform_ = glGetUniformLocation(ShaderProgram_, "perspectiveMatrix");
+	glGenBuffers(1, &mesh.VertexBuffer);
+	glBindBuffer(GL_ARRAY_BUFFER, mesh.VertexBuffer);
+	glBufferData(GL_ARRAY_BUFFER, positions.size_bytes() + colours.size_bytes(), nullptr, GL_STATIC_DRAW);
+	glBufferSubData(GL_ARRAY_BUFFER, 0, positions.size_bytes(), positions.data());
+	glBufferSubData(GL_ARRAY_BUFFER, positions.size_bytes(), colours.size_bytes(), colours.data());
 
-	float near = 0.1f;
-	float far = 3.0f;
+	glGenVertexArrays(1, &mesh.VertexArray);
+	glBindVertexArray(mesh.VertexArray);
 
-	std::ranges::fill(PerspectiveMatrix_, 0.f);
-	PerspectiveMatrix_(0, 0) = FrustumScale_ / (width / static_cast<float>(height));
-	PerspectiveMatrix_(1, 1) = FrustumScale_;
-	PerspectiveMatrix_(2, 2) = (far + near) / (near - far);
-	PerspectiveMatrix_(2, 3) = (2 * far * near) / (near - far);
-	PerspectiveMatrix_(3, 2) = -1.0f;
+	glEnableVertexAttribArray(0);
+	glEnableVertexAttribArray(1);
+	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, 0);
+	glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 0, reinterpret_cast<void*>(positions.size_bytes()));
+
+	// The transform advances once per instance rather than per vertex. Where it's read from is set for each batch.
+	for (GLuint row = 0; row < 4; ++row)
+	{
+		glEnableVertexAttribArray(TransformAttribute + row);
+		glVertexAttribDivisor(TransformAttribute + row, 1);
+	}
 
-	glUseProgram(ShaderProgram_);
-	// ``transpose`` determines means the matrix is in row-major order.
-	glUniformMatrix4fv(PerspectiveMatrixUniform_, 1, GL_TRUE, PerspectiveMatrix_.data());
-	glUseProgram(0);
+	glGenBuffers(1, &mesh.IndexBuffer);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.IndexBuffer);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size_bytes(), indices.data(), GL_STATIC_DRAW);
+
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	Meshes_.push_back(mesh);
+	return static_cast<MeshHandle>(Meshes_.size() - 1);
 }
 
-void Engine3::Renderer::InitialiseVertexBufferObjects()
+std::optional<Engine3::ShaderHandle> Engine3::Renderer::AddShader(std::string_view vertexShaderFileName,
+                                                                  std::string_view fragmentShaderFileName)
 {
-	glGenBuffers(1, &VertexBufferHandle_);
+	if (Shaders_.size() == SortKey::ShaderCount)
+	{
+		std::print("Error! There can't be more than {} shaders!\n", SortKey::ShaderCount);
+		return std::nullopt;
+	}
 
-	glBindBuffer(GL_ARRAY_BUFFER, VertexBufferHandle_);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(Vertices_), Vertices_.data(), GL_STATIC_DRAW);
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	std::vector<GLuint> shaderList;
+
+	shaderList.push_back(LoadShader(GL_VERTEX_SHADER, vertexShaderFileName));
+	shaderList.push_back(LoadShader(GL_FRAGMENT_SHADER, fragmentShaderFileName));
+
+	Shader shader{};
+	shader.Program = CreateProgram(shaderList);
 
-	glGenBuffers(1, &IndexBufferHandle_);
+	// Binding points can't be given in the shader before GLSL 4.20, so each block is pointed at its binding here.
+	const GLuint cameraBlock = glGetUniformBlockIndex(shader.Program, "Camera");
+	if (cameraBlock != GL_INVALID_INDEX)
+	{
+		glUniformBlockBinding(shader.Program, cameraBlock, static_cast<GLuint>(UniformBinding::Camera));
+	}
 
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, IndexBufferHandle_);
-	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(IndexData_), IndexData_.data(), GL_STATIC_DRAW);
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	Shaders_.push_back(shader);
+	return static_cast<ShaderHandle>(Shaders_.size() - 1);
 }
 
-void Engine3::Renderer::InitialiseVertexArrayObjects()
+std::optional<Engine3::MaterialHandle> Engine3::Renderer::AddMaterial(ShaderHandle shader, bool isTranslucent)
 {
-	glGenVertexArrays(1, &VertexArrayHandle_);
-	glBindVertexArray(VertexArrayHandle_);
+	if (shader >= Shaders_.size())
+	{
+		std::print("Error! Shader {} hasn't been added!\n", shader);
+		return std::nullopt;
+	}
 
-	size_t colorDataOffset = sizeof(float) * 3 * numberOfVertices;
-	glBindBuffer(GL_ARRAY_BUFFER, VertexBufferHandle_);
-	glEnableVertexAttribArray(0);
-	glEnableVertexAttribArray(1);
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, 0);
-	glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, 0, (void*)colorDataOffset);
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, IndexBufferHandle_);
+	if (Materials_.size() == SortKey::MaterialCount)
+	{
+		std::print("Error! There can't be more than {} materials!\n", SortKey::MaterialCount);
+		return std::nullopt;
+	}
 
-	glBindVertexArray(0);
+	Materials_.push_back({shader, isTranslucent});
+	return static_cast<MaterialHandle>(Materials_.size() - 1);
+}
+
+bool Engine3::Renderer::IsLayerValid(std::uint32_t layer)
+{
+	if (layer < SortKey::LayerCount) { return true; }
+
+	std::print("Error! Layer {} is past the last, {}!\n", layer, SortKey::LayerCount - 1);
+	return false;
+}
+
+Engine3::SortKey Engine3::Renderer::MakeSortKey(MeshHandle mesh, MaterialHandle material,
+                                                const Matrix<4>& transform, std::uint32_t layer) const
+{
+	// The camera looks down -Z, so an object's depth is how far along that its origin is once in view. Only the
+	// origin's Z is needed, rather than multiplying the whole matrix by the view.
+	float viewZ = 0;
+	for (std::size_t i = 0; i < 4; ++i) { viewZ += transform(3, i) * Camera_.View(i, 2); }
+
+	SortKey key;
+	key.Layer = layer;
+	key.IsTranslucent = Materials_[material].IsTranslucent;
+	key.Shader = Materials_[material].Shader;
+	key.Material = material;
+	key.Mesh = mesh;
+	key.Depth = (-viewZ - Near_) / (Far_ - Near_);
+
+	return key;
 }
 
 Engine3::Renderer::Renderer(Window& window) :
@@ -165,6 +357,9 @@ Engine3::Renderer::Renderer(Window& window) :
 		assert(false);
 	}
 
+	// Only takes effect once a context is current, so it can't be set any earlier.
+	SetVerticalSync(true);
+
 	// Initialize GLEW to setup OpenGL functions.
 	GLenum glewStatus = glewInit();
 	if (glewStatus != GLEW_OK)
@@ -181,8 +376,8 @@ Engine3::Renderer::Renderer(Window& window) :
 
 	/* Create Vertex Buffer Object */
 	InitialiseProgram(window.GetSize().first, window.GetSize().second);
-	InitialiseVertexBufferObjects();
-	InitialiseVertexArrayObjects();
+	InitialiseStreamBuffer();
+	InitialiseMeshes();
 
 	glEnable(GL_CULL_FACE);
 	glCullFace(GL_BACK);
@@ -202,30 +397,27 @@ void Engine3::Renderer::Render()
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
 	/* Draw to the screen*/
-	glUseProgram(ShaderProgram_);
+	Batcher_.Build();
 
-	glBindVertexArray(VertexArrayHandle_);
-	glUniform3f(OffsetUniform_, 0.0f, 0.0f, -1.0f);
-	glDrawElements(GL_TRIANGLES, IndexData_.size(), GL_UNSIGNED_SHORT, nullptr);
+	FrameCommands_.Clear();
+	Batcher_.Encode(FrameCommands_);
 
-	glUniform3f(OffsetUniform_, 0.0f, 0.0f, -1.0f);
-	glDrawElementsBaseVertex(GL_TRIANGLES, IndexData_.size(), GL_UNSIGNED_SHORT, nullptr, numberOfVertices / 2);
+	OpenGLBackend backend{*this};
+	Replay(FrameCommands_, Batcher_.GetInstanceTransforms(), backend);
 
-	glBindVertexArray(0);
-	glUseProgram(0);
+	Batcher_.Clear();
 
 	/* Finally, swap the buffers. */
 	SDL_GL_SwapWindow(Window_.Window_.get());
 }
 
+bool Engine3::Renderer::SetVerticalSync(bool enabled) { return SDL_GL_SetSwapInterval(enabled ? 1 : 0) == 0; }
+
 void Engine3::Renderer::SetSize(const int width, const int height)
 {
-	PerspectiveMatrix_(0, 0) = FrustumScale_ / (width / static_cast<float>(height));
-	PerspectiveMatrix_(1, 1) = FrustumScale_;
-
-	glUseProgram(ShaderProgram_);
-	glUniformMatrix4fv(PerspectiveMatrixUniform_, 1, GL_TRUE, PerspectiveMatrix_.data());
-	glUseProgram(0);
+	// Uploaded with the next frame, for every shader at once.
+	Camera_.Perspective(0, 0) = FrustumScale_ / (width / static_cast<float>(height));
+	Camera_.Perspective(1, 1) = FrustumScale_;
 
 	glViewport(0, 0, width, height);
 }
@@ -1,7 +1,17 @@
 #pragma once
+#include "StreamBuffer.h"
 #include "Window.h"
 #include "../Maths/Matrix.h"
+#include "../Rendering/CommandBuffer.h"
+#include "../Rendering/DrawBatcher.h"
+#include "../Rendering/UniformBlocks.h"
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string_view>
 #include <vector>
 #include <GL/glew.h>
 
@@ -10,28 +20,62 @@ namespace Engine3
 	class Renderer
 	{
 	private:
+		struct Mesh
+		{
+			GLuint VertexBuffer;
+			GLuint IndexBuffer;
+			GLuint VertexArray;
+			GLsizei IndexCount;
+		};
+
+		struct Shader
+		{
+			GLuint Program;
+		};
+
+		struct Material
+		{
+			ShaderHandle Shader;
+			bool IsTranslucent;
+		};
+
+		// Replays commands with OpenGL, so it has to be on the thread with the context.
+		class OpenGLBackend;
+
+		/// The first of the four attributes each instance's transform is passed in, one per row.
+		static constexpr GLuint TransformAttribute = 2;
+
 		std::unique_ptr<void, void(*)(void*)> OpenGLContext_ = {nullptr, nullptr};
 
 		Window& Window_;
 
 		bool IsInitialised_ = true;
 
-		GLuint VertexBufferHandle_;
+		std::vector<Mesh> Meshes_;
+
+		std::vector<Shader> Shaders_;
 
-		GLuint VertexArrayHandle_;
+		std::vector<Material> Materials_;
 
-		GLuint IndexBufferHandle_;
+		// Every batch's transforms for the frame are uploaded to it in one go. Created once there's a context.
+		std::optional<StreamBuffer> Stream_;
 
-		GLuint ShaderProgram_;
+		DrawBatcher Batcher_;
 
-		GLint OffsetUniform_;
+		// The batches encoded as commands, reused every frame.
+		CommandBuffer FrameCommands_;
 
-		GLint PerspectiveMatrixUniform_;
+		std::size_t DrawCallCount_ = 0;
 
-		Matrix<4> PerspectiveMatrix_;
+		// Shared by every shader through its Camera block, and uploaded once a frame.
+		CameraUniforms Camera_;
 
 		float FrustumScale_ = 1.0f;
 
+		float Near_ = 0.1f;
+
+		float Far_ = 3.0f;
+
 		const int numberOfVertices = 36;
 
 #define RIGHT_EXTENT 0.8f
@@ -159,11 +203,14 @@ namespace Engine3
 
 		static GLuint CreateProgram(const std::vector<GLuint>& shaderList);
 
+		// Layers past what a sort key holds would be cut down, drawing in the wrong order.
+		static bool IsLayerValid(std::uint32_t layer);
+
 		void InitialiseProgram(int width, int height);
 
-		void InitialiseVertexBufferObjects();
+		void InitialiseStreamBuffer();
 
-		void InitialiseVertexArrayObjects();
+		void InitialiseMeshes();
 
 	public:
 		/* CONSTRUCTORS */
@@ -181,10 +228,87 @@ namespace Engine3
 		Renderer& operator=(Renderer&& other) noexcept = delete;
 
 		/* METHODS */
+		/// The meshes, shader and material the renderer starts with.
+		static constexpr MeshHandle FirstObject = 0;
+		static constexpr MeshHandle SecondObject = 1;
+		static constexpr ShaderHandle DefaultShader = 0;
+		static constexpr MaterialHandle DefaultMaterial = 0;
+
+		/// @param positions Three floats for each vertex.
+		/// @param colours Four floats for each vertex.
+		/// @return The handle to submit the mesh with, or nothing if there are already SortKey::MeshCount meshes.
+		std::optional<MeshHandle> AddMesh(std::span<const float> positions, std::span<const float> colours,
+		                                  std::span<const GLshort> indices);
+
+		/// Compiles and links the shaders, which must accept the same attributes as the default ones. Any uniform blocks
+		/// named as in UniformBinding are bound to theirs.
+		/// @return The handle to make materials with, or nothing if there are already SortKey::ShaderCount shaders.
+		std::optional<ShaderHandle> AddShader(std::string_view vertexShaderFileName,
+		                                      std::string_view fragmentShaderFileName);
+
+		/// @param isTranslucent Whether it's blended with what's behind it, so it's drawn after everything opaque, from
+		/// the furthest to the nearest.
+		/// @return The handle to submit meshes with, or nothing if \p shader wasn't added or there are already
+		/// SortKey::MaterialCount materials.
+		std::optional<MaterialHandle> AddMaterial(ShaderHandle shader, bool isTranslucent = false);
+
+		/// @return The key that orders the draw among the others. Reads nothing that changes while drawing, so it's safe
+		/// to call from any thread as long as no material is being added and the view isn't being set.
+		SortKey MakeSortKey(MeshHandle mesh, MaterialHandle material, const Matrix<4>& transform,
+		                    std::uint32_t layer = 0) const;
+
+		/// Records \p mesh to be drawn with \p material once \p commands is submitted. Doesn't touch OpenGL or the
+		/// renderer's queue, so worker threads can each record into their own buffer at the same time.
+		/// @param transform The world matrix, for row vectors.
+		void Record(CommandBuffer& commands, MeshHandle mesh, MaterialHandle material, const Matrix<4>& transform,
+		            std::uint32_t layer = 0) const
+		{
+			if (!IsLayerValid(layer)) { return; }
+			commands.Draw(MakeSortKey(mesh, material, transform, layer), transform);
+		}
+
+		/// Queues \p mesh to be drawn with \p material by the next Render.
+		/// @param transform The world matrix, for row vectors.
+		/// @param layer Drawn after every lower layer, before anything else decides the order. Must be less than
+		/// SortKey::LayerCount, otherwise nothing is drawn.
+		void Submit(MeshHandle mesh, MaterialHandle material, const Matrix<4>& transform, std::uint32_t layer = 0)
+		{
+			if (!IsLayerValid(layer)) { return; }
+			Batcher_.Submit(MakeSortKey(mesh, material, transform, layer), transform);
+		}
+
+		/// Queues an instance of \p mesh for each of \p transforms, e.g. TransformHierarchy::GetWorldMatrices.
+		void Submit(MeshHandle mesh, MaterialHandle material, std::span<const Matrix<4>> transforms,
+		            std::uint32_t layer = 0)
+		{
+			for (const Matrix<4>& transform : transforms) { Submit(mesh, material, transform, layer); }
+		}
+
+		/// Queues every draw recorded in \p commands, once whichever thread recorded it is done with it. Buffers should be
+		/// submitted in the same order each frame, e.g. by worker, so draws that sort equally don't swap between frames.
+		void Submit(const CommandBuffer& commands) { Batcher_.Submit(commands); }
+
+		/// Draws everything submitted since the last Render, with one instanced draw call for each mesh and material
+		/// used, then presents it.
 		void Render();
 
+		/// @return The number of draw calls the last Render made.
+		std::size_t GetDrawCallCount() const { return DrawCallCount_; }
+
+		/// @return How many draw calls and state changes the last Render made, and how many sorting avoided.
+		const DrawStats& GetStats() const { return Batcher_.GetStats(); }
+
+		/// @param view From the world to the camera, for row vectors, which the scene is drawn through from the next
+		/// Render.
+		void SetView(const Matrix<4>& view) { Camera_.View = view; }
+
 		void SetSize(const int width, const int height);
 
+		/// Frames can instead be paced by FrameClock::SetTargetFrameTime, which doesn't depend on the driver honouring
+		/// the swap interval.
+		/// @return Whether the swap interval could be set.
+		bool SetVerticalSync(bool enabled);
+
 		/* CONVERSION OPERATORS */
 		explicit operator bool() const { return IsInitialised_; }
 	};
@@ -0,0 +1,116 @@
+#include "StreamBuffer.h"
+#include <algorithm>
+#include <bit>
+#include <print>
+
+Engine3::StreamBuffer::StreamBuffer(const std::size_t frameSize) : Ring_(frameSize, FramesInFlight)
+{
+	glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &UniformAlignment_);
+	assert(UniformAlignment_ > 0 && static_cast<std::size_t>(UniformAlignment_) <= UploadRing::MaximumAlignment);
+
+	Create(frameSize);
+}
+
+void Engine3::StreamBuffer::Create(const std::size_t frameSize)
+{
+	Ring_ = UploadRing{frameSize, FramesInFlight};
+	IsPersistent_ = GLEW_VERSION_4_4 || GLEW_ARB_buffer_storage;
+
+	glGenBuffers(1, &Handle_);
+	glBindBuffer(GL_ARRAY_BUFFER, Handle_);
+	const GLsizeiptr size = static_cast<GLsizeiptr>(Ring_.GetSize());
+	if (IsPersistent_)
+	{
+		// Coherent, so writes are seen by the GPU without flushing them.
+		constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glBufferStorage(GL_ARRAY_BUFFER, size, nullptr, flags);
+		Mapping_ = static_cast<std::byte*>(glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags));
+		if (!Mapping_)
+		{
+			std::print("Error! Couldn't map the stream buffer!\n");
+			assert(false);
+		}
+	}
+	else { glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_STREAM_DRAW); }
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void Engine3::StreamBuffer::Destroy()
+{
+	for (GLsync& fence : Fences_) { Wait(fence); }
+
+	if (Mapping_ || Region_)
+	{
+		glBindBuffer(GL_ARRAY_BUFFER, Handle_);
+		glUnmapBuffer(GL_ARRAY_BUFFER);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		Mapping_ = nullptr;
+		Region_ = nullptr;
+	}
+
+	glDeleteBuffers(1, &Handle_);
+	Handle_ = 0;
+}
+
+void Engine3::StreamBuffer::Wait(GLsync& fence)
+{
+	if (!fence) { return; }
+
+	// Commands are flushed so the fence is certain to be signalled eventually, rather than waiting forever.
+	GLenum status;
+	do { status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000); }
+	while (status == GL_TIMEOUT_EXPIRED);
+
+	if (status == GL_WAIT_FAILED) { std::print("Error! Couldn't wait for a frame to finish!\n"); }
+
+	glDeleteSync(fence);
+	fence = nullptr;
+}
+
+void Engine3::StreamBuffer::BeginFrame(const std::size_t minimumSize)
+{
+	if (minimumSize > Ring_.GetFrameSize())
+	{
+		Destroy();
+		Create(std::bit_ceil(std::max(minimumSize, Ring_.GetFrameSize() * 2)));
+	}
+
+	Wait(Fences_[Ring_.GetFrame()]);
+
+	if (IsPersistent_) { Region_ = Mapping_ + Ring_.GetFrameOffset(); }
+	else
+	{
+		// Explicitly flushed, so only what's written is copied back to the GPU rather than the whole region.
+		constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT |
+			GL_MAP_FLUSH_EXPLICIT_BIT;
+		glBindBuffer(GL_ARRAY_BUFFER, Handle_);
+		Region_ = static_cast<std::byte*>(glMapBufferRange(GL_ARRAY_BUFFER,
+		                                                   static_cast<GLintptr>(Ring_.GetFrameOffset()),
+		                                                   static_cast<GLsizeiptr>(Ring_.GetFrameSize()), flags));
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		if (!Region_)
+		{
+			std::print("Error! Couldn't map the stream buffer!\n");
+			assert(false);
+		}
+	}
+}
+
+void Engine3::StreamBuffer::Flush()
+{
+	// A persistent mapping is coherent, so there's nothing to do, and it stays mapped while it's drawn from.
+	if (IsPersistent_ || !Region_) { return; }
+
+	glBindBuffer(GL_ARRAY_BUFFER, Handle_);
+	glFlushMappedBufferRange(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(Ring_.GetUsed()));
+	glUnmapBuffer(GL_ARRAY_BUFFER);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	Region_ = nullptr;
+}
+
+void Engine3::StreamBuffer::EndFrame()
+{
+	Flush();
+	Fences_[Ring_.GetFrame()] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	Ring_.NextFrame();
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include "../Rendering/UploadRing.h"
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <GL/glew.h>
+
+namespace Engine3
+{
+	/// One OpenGL buffer for data that changes every frame, such as instance transforms and uniforms, written straight
+	/// into mapped memory rather than copied in by the driver. \n
+	/// Each frame writes to its own region, and a fence after the frame's draws means a region is only written again
+	/// once the GPU is done reading it, so neither waits on the other. Mapped once for good with ARB_buffer_storage,
+	/// otherwise each frame's region is mapped unsynchronised, which is safe as the fence has already been waited on.
+	class StreamBuffer
+	{
+	public:
+		static constexpr std::size_t FramesInFlight = 3;
+
+	private:
+		UploadRing Ring_;
+
+		GLuint Handle_ = 0;
+
+		bool IsPersistent_ = false;
+
+		// The whole buffer, when it's mapped for good.
+		std::byte* Mapping_ = nullptr;
+
+		// The start of the current frame's region, while it's mapped.
+		std::byte* Region_ = nullptr;
+
+		std::array<GLsync, FramesInFlight> Fences_{};
+
+		GLint UniformAlignment_ = UploadRing::MaximumAlignment;
+
+		void Create(std::size_t frameSize);
+
+		void Destroy();
+
+		void Wait(GLsync& fence);
+
+	public:
+		/* CONSTRUCTORS */
+		/// Needs a current context.
+		/// @param frameSize How much each frame can upload before the buffer has to grow.
+		explicit StreamBuffer(std::size_t frameSize);
+
+		~StreamBuffer() { Destroy(); }
+
+		/* COPY AND MOVE OPERATIONS*/
+		StreamBuffer(const StreamBuffer& other) = delete;
+
+		StreamBuffer(StreamBuffer&& other) noexcept = delete;
+
+		StreamBuffer& operator=(const StreamBuffer& other) = delete;
+
+		StreamBuffer& operator=(StreamBuffer&& other) noexcept = delete;
+
+		/* METHODS */
+		/// Waits for the GPU to finish with the current frame's region, if it hasn't already, and maps it. \n
+		/// Growing the buffer waits for every frame in flight, so \p minimumSize should be generous.
+		/// @param minimumSize How much the frame will upload, which the buffer grows to fit if it needs to.
+		void BeginFrame(std::size_t minimumSize = 0);
+
+		/// Copies \p data into the current frame's region, between BeginFrame and Flush.
+		/// @return Its offset in the buffer, or nothing if the region is full.
+		template <class T>
+		std::optional<std::size_t> Upload(std::span<const T> data, std::size_t alignment = 16)
+		{
+			assert(Region_);
+			const std::optional<std::size_t> offset = Ring_.Allocate(data.size_bytes(), alignment);
+			if (offset) { std::memcpy(Region_ + (*offset - Ring_.GetFrameOffset()), data.data(), data.size_bytes()); }
+			return offset;
+		}
+
+		/// Makes what was uploaded visible to OpenGL, which must happen before anything is drawn with it.
+		void Flush();
+
+		/// Fences the frame's draws, so the region isn't written again until they're done, then moves to the next.
+		void EndFrame();
+
+		GLuint GetHandle() const { return Handle_; }
+
+		/// @return The alignment uniform buffer ranges bound from it need.
+		std::size_t GetUniformAlignment() const { return static_cast<std::size_t>(UniformAlignment_); }
+
+		/// @return Whether it's mapped once for good, rather than every frame.
+		bool IsPersistent() const { return IsPersistent_; }
+	};
+}
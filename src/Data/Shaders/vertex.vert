@@ -3,15 +3,23 @@
 layout(location = 0) in vec4 position;
 layout(location = 1) in vec4 color;
 
-smooth out vec4 theColor;
+// Per instance. Uploaded a row at a time from a matrix for row vectors, so it arrives transposed for column vectors.
+layout(location = 2) in mat4 transform;
+
+// Shared by every shader, at the binding the renderer gives it. Row major, so the matrices arrive as they're stored.
+layout(std140, row_major) uniform Camera
+{
+	mat4 perspectiveMatrix;
+	// For row vectors, so it's multiplied on the right.
+	mat4 viewMatrix;
+};
 
-uniform vec3 offset;
-uniform mat4 perspectiveMatrix;
+smooth out vec4 theColor;
 
 void main()
 {
-	vec4 cameraPos = position + vec4(offset.x, offset.y, offset.z, 0.0);
+	vec4 cameraPos = (transform * position) * viewMatrix;
 
 	gl_Position = perspectiveMatrix * cameraPos;
 	theColor = color;
-}
\ No newline at end of file
+}
@@ -1,34 +1,111 @@
 #include "Action.h"
+#include "InputManager.h"
+#include <algorithm>
 #include <ranges>
+#include <utility>
 
-void Engine3::Action::Update(InternalInputType type, ProcessState state, InputValue value)
+namespace
 {
-	auto iterator = BoundInputs.find(type);
-	if (iterator == BoundInputs.end()) { return; }
+	// std::visit dispatches through a table of function pointers, which the compiler can't inline. Comparing the index
+	// against each alternative in turn lets each call be inlined, and the few alternatives are quickly compared.
+	template <std::size_t Index = 0, class Variant, class Function>
+	decltype(auto) VisitInline(Variant& variant, Function&& function)
+	{
+		if constexpr (Index + 1 == std::variant_size_v<Variant>) { return function(*std::get_if<Index>(&variant)); }
+		else
+		{
+			if (variant.index() == Index) { return function(*std::get_if<Index>(&variant)); }
+			return VisitInline<Index + 1>(variant, std::forward<Function>(function));
+		}
+	}
+}
 
-	Input& input = iterator->second;
-	input.CurrentState = state;
-	input.Value = value;
+Engine3::Input& Engine3::Action::AddInput(InternalInputType type, std::int32_t player)
+{
+	for (std::size_t i = 0; i < Types.size(); ++i)
+	{
+		if (Types[i] == type && Players[i] == player) { return Inputs[i]; }
+	}
+
+	return AppendInput(type, player);
+}
+
+Engine3::Input& Engine3::Action::AppendInput(InternalInputType type, std::int32_t player)
+{
+	Manager.Bind(type, {this, static_cast<std::uint32_t>(Inputs.size()), player});
+	Types.push_back(type);
+	Players.push_back(player);
+	return Inputs.emplace_back(Input{});
+}
+
+void Engine3::Action::Reserve(std::size_t count)
+{
+	Inputs.reserve(Inputs.size() + count);
+	Types.reserve(Types.size() + count);
+	Players.reserve(Players.size() + count);
+}
+
+void Engine3::Action::Activate(std::uint32_t input)
+{
+	// Kept sorted so inputs are always processed in the order they were added, which decides ties between them.
+	Inputs[input].IsActive = true;
+	ActiveInputs.insert(std::ranges::upper_bound(ActiveInputs, input), input);
+}
+
+void Engine3::Action::StopInputs()
+{
+	for (std::uint32_t input : ActiveInputs)
+	{
+		Input& target = Inputs[input];
+		target.CurrentState = ProcessState::Stop;
+		target.IsActive = false;
+		target.Pressed = target.Released = false;
+
+		// Its release will never be seen, so conditions mustn't go on thinking it's held.
+		for (ConditionVariant& condition : target.Conditions)
+		{
+			VisitInline(condition, [](auto& alternative) { alternative.Reset(); });
+		}
+	}
+
+	ActiveInputs.clear();
+}
+
+bool Engine3::Action::RemoveStoppedInputs()
+{
+	std::erase_if(ActiveInputs, [this](std::uint32_t input)
+	{
+		// Only held inputs carry on. A press or release happens once, whether or not its conditions let it through,
+		// otherwise one that's rejected would stay active and be processed every frame.
+		Input& target = Inputs[input];
+		target.Pressed = target.Released = false;
+		if (target.CurrentState == ProcessState::Continuous) { return false; }
+
+		target.CurrentState = ProcessState::Stop;
+		target.IsActive = false;
+		return true;
+	});
+
+	return !ActiveInputs.empty();
 }
 
 template <typename... T>
 auto Engine3::Implementation::Action<T...>::FilterInputs()
 {
 	auto enabled = [](const Input& input) { return input.CurrentState != ProcessState::Stop; };
-	auto conditions = [](const Input& input)
+	auto conditions = [](Input& input)
 	{
-		return std::ranges::all_of(input.Conditions, [&input](const std::unique_ptr<Condition>& condition)
+		return std::ranges::all_of(input.Conditions, [&input](ConditionVariant& condition)
 		{
-			return (*condition)(input);
+			return VisitInline(condition, [&input](auto& alternative) { return alternative(input); });
 		});
 	};
 
-	// This is lazily evaluated and the modifiers alter their own state, so it must not be accessed until
+	// This is lazily evaluated and conditions can alter their own state, so it must not be accessed until
 	// each element is acted upon otherwise a condition could change.
-	// E.G. PressedCondition will set its previous process state which if called multiple times will
-	// result in it treating an input as a hold when it's actually only been pressed.
-	return BoundInputs
-		| std::views::values
+	// E.G. a custom condition counting presses would count one several times if called multiple times.
+	return ActiveInputs
+		| std::views::transform([this](std::uint32_t input) -> Input& { return Inputs[input]; })
 		| std::views::filter(enabled)
 		| std::views::filter(conditions);
 }
@@ -37,11 +114,8 @@ template <>
 void Engine3::Implementation::Action<>::Process()
 {
 	bool execute = false;
-	for (auto& input : FilterInputs())
-	{
-		execute = true;
-		if (input.CurrentState != ProcessState::Continuous) { input.CurrentState = ProcessState::Stop; }
-	}
+	// Every input is filtered even once one has passed, as conditions keep state that has to see each update.
+	for ([[maybe_unused]] Input& input : FilterInputs()) { execute = true; }
 
 	if (execute) { BoundFunction(); }
 }
@@ -63,13 +137,14 @@ void Engine3::Implementation::Action<float>::Process()
 	for (Input& input : FilterInputs())
 	{
 		execute = true;
-		float value = std::visit(toFloat, input.Value);
-		for (const auto& modifier : input.Modifiers) { (*modifier)(value); }
+		float value = VisitInline(input.Value, toFloat);
+		for (ModifierVariant& modifier : input.Modifiers)
+		{
+			VisitInline(modifier, [&value](auto& alternative) { alternative(value); });
+		}
 
 		if (CumulateInputs) { finalValue += value; }
 		else { finalValue = std::abs(value) > std::abs(finalValue) ? value : finalValue; }
-
-		if (input.CurrentState != ProcessState::Continuous) { input.CurrentState = ProcessState::Stop; }
 	}
 
 	if (execute) { BoundFunction(finalValue); }
@@ -92,8 +167,11 @@ void Engine3::Implementation::Action<Engine3::Vector<2>>::Process()
 	for (Input& input : FilterInputs())
 	{
 		execute = true;
-		Vector<2> value = std::visit(toVector2, input.Value);
-		for (const auto& modifier : input.Modifiers) { (*modifier)(value); }
+		Vector<2> value = VisitInline(input.Value, toVector2);
+		for (ModifierVariant& modifier : input.Modifiers)
+		{
+			VisitInline(modifier, [&value](auto& alternative) { alternative(value); });
+		}
 
 		if (CumulateInputs) { finalValue += value; }
 		else
@@ -101,8 +179,6 @@ void Engine3::Implementation::Action<Engine3::Vector<2>>::Process()
 			finalValue.X(std::abs(value.X()) > std::abs(finalValue.X()) ? value.X() : finalValue.X());
 			finalValue.Y(std::abs(value.Y()) > std::abs(finalValue.Y()) ? value.Y() : finalValue.Y());
 		}
-
-		if (input.CurrentState != ProcessState::Continuous) { input.CurrentState = ProcessState::Stop; }
 	}
 
 	if (execute) { BoundFunction(finalValue); }
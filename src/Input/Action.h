@@ -1,12 +1,17 @@
 #pragma once
 #include "../Maths/Vector.h"
+#include "../Utility/InlineVector.h"
 #include "Conditions/Condition.h"
 #include "Modifiers/Modifier.h"
+#include "ProcessState.h"
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
-#include <map>
 #include <memory>
 #include <SDL.h>
 #include <variant>
+#include <vector>
 
 namespace Engine3::Implementation
 {
@@ -20,13 +25,14 @@ namespace Engine3
 
 	using InputValue = std::variant<std::monostate, float, Vector<2>>;
 
-	enum class ProcessState
+	namespace Implementation
 	{
-		Stop,
-		Once,
-		Continuous,
-		Release
-	};
+		template <typename T, typename Variant>
+		constexpr bool IsAlternativeOf = false;
+
+		template <typename T, typename... Alternatives>
+		constexpr bool IsAlternativeOf<T, std::variant<Alternatives...>> = (std::same_as<T, Alternatives> || ...);
+	}
 
 	class Input
 	{
@@ -36,6 +42,9 @@ namespace Engine3
 		friend class Implementation::Action;
 
 	public:
+		/// Binds a controller's input to every player, and is the player of input that isn't from a controller.
+		static constexpr std::int32_t AnyPlayer = -1;
+
 		// Don't want public code to be dependent on SDL,
 		enum class Key
 		{
@@ -292,6 +301,13 @@ namespace Engine3
 			TriggerRight = SDL_CONTROLLER_AXIS_TRIGGERRIGHT
 		};
 
+		/// Both axes of a stick together, as a Vector<2>, so dead zones see the stick as a whole.
+		enum class GamepadStick
+		{
+			Left,
+			Right
+		};
+
 		enum class GamepadButton
 		{
 			A = SDL_CONTROLLER_BUTTON_A,
@@ -320,30 +336,65 @@ namespace Engine3
 	private:
 		Input() = default;
 
-		std::vector<std::unique_ptr<Modifier>> Modifiers;
+		// Stored inline and called without a virtual call, as there's rarely more than a couple of each.
+		InlineVector<ModifierVariant, 2> Modifiers;
 
-		std::vector<std::unique_ptr<Condition>> Conditions;
+		InlineVector<ConditionVariant, 1> Conditions;
 
 		ProcessState CurrentState = ProcessState::Stop;
 
 		InputValue Value;
 
+		// Whether it's in its action's list of active inputs.
+		bool IsActive = false;
+
+		// Latched until its action is processed, as only the last state is kept, so a press and release in the same
+		// frame are both seen.
+		bool Pressed = false;
+		bool Released = false;
+
 	public:
 		ProcessState GetCurrentState() const { return CurrentState; }
 
+		/// @return Whether it's been pressed since its action was last processed, even if it's since been released.
+		bool WasPressed() const { return Pressed; }
+
+		/// @return Whether it's been released since its action was last processed, even if it's since been pressed.
+		bool WasReleased() const { return Released; }
+
 		InputValue GetValue() const { return Value; }
 
+		/// @tparam T Either a built in modifier, or one derived from Modifier.
 		template <typename T, typename... Args>
 		Input& AddModifier(Args&&... args)
 		{
-			Modifiers.emplace_back(std::make_unique<T>(std::forward<T>(args)...));
+			if constexpr (Implementation::IsAlternativeOf<T, ModifierVariant>)
+			{
+				Modifiers.EmplaceBack(std::in_place_type<T>, std::forward<Args>(args)...);
+			}
+			else
+			{
+				static_assert(std::derived_from<T, Modifier>, "Custom modifiers must derive from Modifier.");
+				Modifiers.EmplaceBack(std::in_place_type<CustomModifier>, std::make_unique<T>(std::forward<Args>(args)...));
+			}
+
 			return *this;
 		}
 
+		/// @tparam T Either a built in condition, or one derived from Condition.
 		template <typename T, typename... Args>
 		Input& AddCondition(Args&&... args)
 		{
-			Conditions.emplace_back(std::make_unique<T>(std::forward<T>(args)...));
+			if constexpr (Implementation::IsAlternativeOf<T, ConditionVariant>)
+			{
+				Conditions.EmplaceBack(std::in_place_type<T>, std::forward<Args>(args)...);
+			}
+			else
+			{
+				static_assert(std::derived_from<T, Condition>, "Custom conditions must derive from Condition.");
+				Conditions.EmplaceBack(std::in_place_type<CustomCondition>, std::make_unique<T>(std::forward<Args>(args)...));
+			}
+
 			return *this;
 		}
 	};
@@ -352,7 +403,7 @@ namespace Engine3
 	// This is used internally so that rebinding can be done dynamically at runtime without me having
 	// to explicitly support the type. As long as SDL does, and it's in these enums then it can be used.
 	using InternalInputType = std::variant<
-		SDL_Scancode, Input::Mouse, SDL_GameControllerButton, SDL_GameControllerAxis
+		SDL_Scancode, Input::Mouse, SDL_GameControllerButton, SDL_GameControllerAxis, Input::GamepadStick
 	>;
 
 	class Action
@@ -360,34 +411,90 @@ namespace Engine3
 		friend class InputManager;
 
 	protected:
-		std::map<InternalInputType, Input> BoundInputs;
+		InputManager& Manager;
+
+		// Indexed by the binding table, so must only ever be appended to. Types and Players hold what each input is bound
+		// to.
+		std::vector<Input> Inputs;
+
+		std::vector<InternalInputType> Types;
+
+		std::vector<std::int32_t> Players;
+
+		// The inputs that aren't stopped, in the order they were added, so that processing only looks at those which
+		// have been updated or are held rather than every input bound.
+		std::vector<std::uint32_t> ActiveInputs;
 
 		bool CumulateInputs;
 
-		Action(bool cumulateInputs) : CumulateInputs(cumulateInputs) {}
+		// Whether it's in the manager's list of actions to process, and where it was added so they're processed in order.
+		bool IsQueued = false;
+
+		std::size_t Order = 0;
+
+		Action(InputManager& manager, bool cumulateInputs) : Manager(manager), CumulateInputs(cumulateInputs) {}
+
+		void Update(std::uint32_t input, ProcessState state, InputValue value)
+		{
+			Input& target = Inputs[input];
+			if (state == ProcessState::Release) { target.Released = true; }
+			else if (state != ProcessState::Stop && target.CurrentState != ProcessState::Continuous)
+			{
+				target.Pressed = true;
+			}
+			target.CurrentState = state;
+			target.Value = value;
+
+			if (state != ProcessState::Stop && !target.IsActive) { Activate(input); }
+		}
+
+		void Activate(std::uint32_t input);
 
-		void Update(InternalInputType type, ProcessState state, InputValue value);
+		/// Stops every input that isn't held, and drops them from the active list. Every active input's presses and
+		/// releases are forgotten, as they've now been processed.
+		/// @return Whether any inputs are still active, and so need processing again next frame.
+		bool RemoveStoppedInputs();
 
 		virtual void Process() = 0;
 
+		/// Adding an input that's already bound returns the existing one.
+		Input& AddInput(InternalInputType type, std::int32_t player = Input::AnyPlayer);
+
+		/// Adds an input without checking whether it's already bound, for when that's been checked up front.
+		Input& AppendInput(InternalInputType type, std::int32_t player);
+
+		/// Makes room for \p count more inputs, so adding them doesn't reallocate.
+		void Reserve(std::size_t count);
+
+		/// Stops every input that's still active, as if each was released without being processed, and resets their
+		/// conditions.
+		void StopInputs();
+
 	public:
 		virtual ~Action() = default;
 
-		Input& AddInput(Input::Key input)
+		/// @return Where it was added among its manager's actions, which BindingProfile refers to it by.
+		std::size_t GetOrder() const { return Order; }
+
+		/// The returned reference is invalidated by adding another input to this action.
+		Input& AddInput(Input::Key input) { return AddInput(static_cast<SDL_Scancode>(input)); }
+
+		Input& AddInput(Input::Mouse input) { return AddInput(InternalInputType{input}); }
+
+		/// @param player Only the controller with this player index triggers the input, rather than any.
+		Input& AddInput(Input::GamepadButton input, std::int32_t player = Input::AnyPlayer)
 		{
-			return BoundInputs.emplace(static_cast<SDL_Scancode>(input), Input{}).first->second;
+			return AddInput(static_cast<SDL_GameControllerButton>(input), player);
 		}
 
-		Input& AddInput(Input::Mouse input) { return BoundInputs.emplace(input, Input{}).first->second; }
-
-		Input& AddInput(Input::GamepadButton input)
+		Input& AddInput(Input::GamepadAxis input, std::int32_t player = Input::AnyPlayer)
 		{
-			return BoundInputs.emplace(static_cast<SDL_GameControllerButton>(input), Input{}).first->second;
+			return AddInput(static_cast<SDL_GameControllerAxis>(input), player);
 		}
 
-		Input& AddInput(Input::GamepadAxis input)
+		Input& AddInput(Input::GamepadStick input, std::int32_t player = Input::AnyPlayer)
 		{
-			return BoundInputs.emplace(static_cast<SDL_GameControllerAxis>(input), Input{}).first->second;
+			return AddInput(InternalInputType{input}, player);
 		}
 	};
 
@@ -407,8 +514,8 @@ namespace Engine3
 		protected:
 			void Process() override;
 
-			Action(std::function<void(T...)> function, bool cumulateInputs)
-				: Engine3::Action(cumulateInputs), BoundFunction(function) {}
+			Action(InputManager& manager, std::function<void(T...)> function, bool cumulateInputs)
+				: Engine3::Action(manager, cumulateInputs), BoundFunction(function) {}
 		};
 	}
 }
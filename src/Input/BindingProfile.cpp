@@ -0,0 +1,127 @@
+#include "BindingProfile.h"
+#include "BindingTable.h"
+#include "../Utility/Varint.h"
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <limits>
+#include <print>
+
+namespace
+{
+	constexpr std::array<std::uint8_t, 5> Header{'E', '3', 'B', 'P', 1};
+
+	// Where input of action would be in the sorted rebindings.
+	auto Find(std::vector<Engine3::Rebinding>& rebindings, std::uint32_t action, std::uint32_t input)
+	{
+		return std::ranges::lower_bound(rebindings, std::pair{action, input}, {},
+		                                [](const Engine3::Rebinding& rebinding)
+		                                {
+			                                return std::pair{rebinding.ActionIndex, rebinding.InputIndex};
+		                                });
+	}
+
+	bool ReadIndex(std::span<const std::uint8_t>& in, std::uint32_t& index)
+	{
+		std::uint64_t value;
+		if (!Engine3::ReadVarint(in, value) || value > std::numeric_limits<std::uint32_t>::max()) { return false; }
+
+		index = static_cast<std::uint32_t>(value);
+		return true;
+	}
+}
+
+void Engine3::BindingProfile::Rebind(std::uint32_t action, std::uint32_t input, const InternalInputType& type,
+                                     std::int32_t player)
+{
+	const auto position = Find(Rebindings, action, input);
+	if (position != Rebindings.end() && position->ActionIndex == action && position->InputIndex == input)
+	{
+		position->Type = type;
+		position->Player = player;
+	}
+	else { Rebindings.insert(position, {action, input, type, player}); }
+}
+
+void Engine3::BindingProfile::Reset(std::uint32_t action, std::uint32_t input)
+{
+	const auto position = Find(Rebindings, action, input);
+	if (position != Rebindings.end() && position->ActionIndex == action && position->InputIndex == input)
+	{
+		Rebindings.erase(position);
+	}
+}
+
+void Engine3::BindingProfile::Save(std::ostream& out) const
+{
+	std::vector<std::uint8_t> bytes{Header.begin(), Header.end()};
+	WriteVarint(Name.size(), bytes);
+	bytes.insert(bytes.end(), Name.begin(), Name.end());
+
+	// Sorted, so each action is written relative to the one before, which is almost always a single zero byte.
+	WriteVarint(Rebindings.size(), bytes);
+	std::uint32_t previousAction = 0;
+	for (const Rebinding& rebinding : Rebindings)
+	{
+		WriteVarint(rebinding.ActionIndex - previousAction, bytes);
+		WriteVarint(rebinding.InputIndex, bytes);
+		WriteVarint(BindingTable::Pack(rebinding.Type), bytes);
+		WriteVarint(ZigZagEncode(rebinding.Player), bytes);
+		previousAction = rebinding.ActionIndex;
+	}
+
+	out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+}
+
+bool Engine3::BindingProfile::Load(std::istream& in)
+{
+	const std::vector<std::uint8_t> bytes{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+	std::span<const std::uint8_t> remaining{bytes};
+	if (remaining.size() < Header.size() || !std::ranges::equal(remaining.first(Header.size()), Header))
+	{
+		std::print("Error! Not a binding profile!\n");
+		return false;
+	}
+	remaining = remaining.subspan(Header.size());
+
+	std::uint64_t nameSize, count;
+	bool isValid = ReadVarint(remaining, nameSize) && nameSize <= remaining.size();
+	std::string name;
+	if (isValid)
+	{
+		name.assign(remaining.begin(), remaining.begin() + static_cast<std::ptrdiff_t>(nameSize));
+		remaining = remaining.subspan(nameSize);
+		isValid = ReadVarint(remaining, count);
+	}
+
+	std::vector<Rebinding> rebindings;
+	std::uint32_t action = 0;
+	for (std::uint64_t i = 0; isValid && i < count; ++i)
+	{
+		std::uint32_t delta;
+		Rebinding& rebinding = rebindings.emplace_back();
+		std::uint64_t packed, player;
+		isValid = ReadIndex(remaining, delta) && ReadIndex(remaining, rebinding.InputIndex) &&
+			ReadVarint(remaining, packed) && packed < BindingTable::Size && ReadVarint(remaining, player);
+		if (!isValid) { break; }
+
+		// Anything else would have been written out of order, or repeated.
+		isValid = delta <= std::numeric_limits<std::uint32_t>::max() - action &&
+			(rebindings.size() == 1 || delta > 0 || rebinding.InputIndex > rebindings.end()[-2].InputIndex);
+		action += delta;
+
+		rebinding.ActionIndex = action;
+		rebinding.Type = BindingTable::Unpack(packed);
+		rebinding.Player = static_cast<std::int32_t>(ZigZagDecode(player));
+	}
+
+	if (!isValid || !remaining.empty())
+	{
+		std::print("Error! Binding profile is truncated or corrupt!\n");
+		return false;
+	}
+
+	Name = std::move(name);
+	Rebindings = std::move(rebindings);
+	return true;
+}
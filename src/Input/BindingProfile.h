@@ -0,0 +1,70 @@
+#pragma once
+#include "Action.h"
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Engine3
+{
+	/// One of an action's inputs bound to a different physical input than the one it was added with.
+	struct Rebinding
+	{
+		/// The action, by the order it was added to its input manager, so a profile saved by one run applies to the next
+		/// as long as the actions are added in the same order.
+		std::uint32_t ActionIndex;
+
+		/// The action's input, by the order it was added to the action.
+		std::uint32_t InputIndex;
+
+		InternalInputType Type;
+
+		/// The only player whose controller triggers it, or Input::AnyPlayer.
+		std::int32_t Player = Input::AnyPlayer;
+	};
+
+	/// A named set of rebindings over the inputs every action was added with, such as a control scheme or a player's
+	/// customised controls, which InputManager::SetProfile swaps in without touching the actions. \n
+	/// Saved as a compact binary of a few varints per rebinding.
+	class BindingProfile
+	{
+	private:
+		// Sorted by action then input, so applying a profile is a single pass alongside the actions.
+		std::vector<Rebinding> Rebindings;
+
+	public:
+		std::string Name;
+
+		/* CONSTRUCTORS */
+		BindingProfile() = default;
+
+		explicit BindingProfile(std::string name) : Name(std::move(name)) {}
+
+		/* METHODS */
+		/// Binds input \p input of \p action to \p type, replacing any earlier rebinding of it.
+		void Rebind(const Action& action, std::uint32_t input, const InternalInputType& type,
+		            std::int32_t player = Input::AnyPlayer)
+		{
+			Rebind(static_cast<std::uint32_t>(action.GetOrder()), input, type, player);
+		}
+
+		void Rebind(std::uint32_t action, std::uint32_t input, const InternalInputType& type,
+		            std::int32_t player = Input::AnyPlayer);
+
+		/// Drops the rebinding of input \p input of \p action, so it's bound to what it was added with again.
+		void Reset(std::uint32_t action, std::uint32_t input);
+
+		/// @return Every rebinding, sorted by action then input.
+		std::span<const Rebinding> GetRebindings() const { return Rebindings; }
+
+		void Save(std::ostream& out) const;
+
+		/// Replaces the name and every rebinding with those saved to \p in.
+		/// @return False, leaving the profile unchanged, if \p in isn't a complete profile.
+		bool Load(std::istream& in);
+	};
+}
@@ -0,0 +1,165 @@
+#pragma once
+#include "Action.h"
+#include "../Maths/Vector.h"
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <tuple>
+#include <utility>
+#include <variant>
+
+namespace Engine3
+{
+	template <typename... T>
+	concept IsFloat = (std::same_as<T, float> || ...);
+
+	template <typename... T>
+	concept IsVector2 = (std::same_as<T, Vector<2>> || ...);
+
+	template <typename... T>
+	concept IsValidType = (IsFloat<T...> || IsVector2<T...>);
+
+	/// The modifiers an InputBinding can describe, the built in ones, as a user defined modifier can't be constructed in
+	/// a constant expression.
+	using BuiltInModifierVariant = std::variant<DeadZoneModifier, SwizzleModifier>;
+
+	/// The conditions an InputBinding can describe, the built in ones.
+	using BuiltInConditionVariant = std::variant<PressedCondition, ReleasedCondition>;
+
+	/// Describes one of an action's inputs at compile time, as Action::AddInput followed by Input::AddModifier and
+	/// Input::AddCondition would build it. \n
+	/// Holds no more modifiers and conditions than an input stores inline, so materialising it never allocates for them.
+	struct InputBinding
+	{
+		static constexpr std::size_t MaximumModifiers = 2;
+
+		static constexpr std::size_t MaximumConditions = 1;
+
+		InternalInputType Type;
+
+		/// The only player whose controller triggers it, or Input::AnyPlayer.
+		std::int32_t Player = Input::AnyPlayer;
+
+		std::array<BuiltInModifierVariant, MaximumModifiers> Modifiers{};
+
+		std::size_t ModifierCount = 0;
+
+		std::array<BuiltInConditionVariant, MaximumConditions> Conditions{};
+
+		std::size_t ConditionCount = 0;
+
+		/* CONSTRUCTORS */
+		// Implicit, so an action's inputs can be listed as the enums themselves.
+		constexpr InputBinding(Input::Key input) : Type(static_cast<SDL_Scancode>(input)) {}
+
+		constexpr InputBinding(Input::Mouse input) : Type(input) {}
+
+		constexpr InputBinding(Input::GamepadButton input, std::int32_t player = Input::AnyPlayer)
+			: Type(static_cast<SDL_GameControllerButton>(input)), Player(player) {}
+
+		constexpr InputBinding(Input::GamepadAxis input, std::int32_t player = Input::AnyPlayer)
+			: Type(static_cast<SDL_GameControllerAxis>(input)), Player(player) {}
+
+		constexpr InputBinding(Input::GamepadStick input, std::int32_t player = Input::AnyPlayer)
+			: Type(input), Player(player) {}
+
+		/* METHODS */
+		/// Adding more than MaximumModifiers doesn't compile.
+		/// @return A copy with a \p T constructed from \p args added after the existing modifiers.
+		template <typename T, typename... Args>
+		constexpr InputBinding WithModifier(Args&&... args) const
+		{
+			InputBinding binding = *this;
+			binding.Modifiers.at(binding.ModifierCount++) =
+				BuiltInModifierVariant{std::in_place_type<T>, std::forward<Args>(args)...};
+			return binding;
+		}
+
+		/// Adding more than MaximumConditions doesn't compile.
+		/// @return A copy with a \p T constructed from \p args added after the existing conditions.
+		template <typename T, typename... Args>
+		constexpr InputBinding WithCondition(Args&&... args) const
+		{
+			InputBinding binding = *this;
+			binding.Conditions.at(binding.ConditionCount++) =
+				BuiltInConditionVariant{std::in_place_type<T>, std::forward<Args>(args)...};
+			return binding;
+		}
+	};
+
+	/// Describes an action and each of its inputs at compile time, as InputManager::AddAction followed by
+	/// Action::AddInput would build it.
+	/// @tparam Count The number of inputs.
+	/// @tparam T The type of value passed to the action's function, if any.
+	template <std::size_t Count, IsValidType... T>
+		requires (sizeof...(T) <= 1)
+	struct ActionBinding
+	{
+		using Function = std::function<void(T...)>;
+
+		static constexpr std::size_t InputCount = Count;
+
+		std::array<InputBinding, Count> Inputs;
+
+		bool CumulateInputs = false;
+
+		/// @return A copy whose inputs are cumulated, as with the cumulateInputs argument of InputManager::AddAction.
+		constexpr ActionBinding Cumulate() const
+		{
+			ActionBinding binding = *this;
+			binding.CumulateInputs = true;
+			return binding;
+		}
+
+		/// @return Whether the same input is bound for the same player more than once, which Action::AddInput would
+		/// have merged.
+		constexpr bool HasDuplicateInputs() const
+		{
+			for (std::size_t i = 0; i < Count; ++i)
+			{
+				for (std::size_t j = i + 1; j < Count; ++j)
+				{
+					if (Inputs[i].Type == Inputs[j].Type && Inputs[i].Player == Inputs[j].Player) { return true; }
+				}
+			}
+
+			return false;
+		}
+	};
+
+	/// @tparam T The type of value passed to the action's function, if any.
+	/// @return An action bound to each of \p inputs, in order.
+	template <IsValidType... T, std::convertible_to<InputBinding>... Inputs>
+	constexpr ActionBinding<sizeof...(Inputs), T...> BindAction(Inputs... inputs)
+	{
+		return {{InputBinding{inputs}...}};
+	}
+
+	/// Describes every action of an input manager, or a part of them, at compile time, so InputManager::AddActions can
+	/// size everything up front and add them without anything growing. Construct it as a constexpr variable, e.g.
+	/// @code
+	/// constexpr BindingSet bindings{
+	///     BindAction<float>(Input::Key::Space, Input::GamepadButton::A).Cumulate(),
+	///     BindAction<Vector<2>>(InputBinding{Input::GamepadStick::Left}.WithModifier<DeadZoneModifier>(0.1f))
+	/// };
+	/// @endcode
+	template <class... Actions>
+	class BindingSet
+	{
+	public:
+		static constexpr std::size_t ActionCount = sizeof...(Actions);
+
+		static constexpr std::size_t InputCount = (Actions::InputCount + ... + 0);
+
+		std::tuple<Actions...> ActionBindings;
+
+		/// Only a constant expression, and an action binding the same input for the same player twice doesn't compile.
+		consteval BindingSet(Actions... actions) : ActionBindings(actions...)
+		{
+			// Not a constant expression, so reaching it fails to compile.
+			if ((actions.HasDuplicateInputs() || ...)) { std::unreachable(); }
+		}
+	};
+}
@@ -0,0 +1,137 @@
+#pragma once
+#include "Action.h"
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace Engine3
+{
+	/// One of an action's inputs, which a physical input is bound to.
+	struct Binding
+	{
+		Action* BoundAction;
+		std::uint32_t Input;
+
+		/// The only player whose controller triggers it, or Input::AnyPlayer.
+		std::int32_t Player = Input::AnyPlayer;
+	};
+
+	/// Maps each physical input to every action input bound to it, so dispatching an event only touches the bindings
+	/// for that input, rather than searching every action. \n
+	/// Physical inputs are packed into a small dense integer so the table is indexed directly rather than hashed, and
+	/// the bindings are stored contiguously, grouped by physical input.
+	class BindingTable
+	{
+	public:
+		/// Where each alternative of InternalInputType starts in the packed range, in the order of the variant.
+		static constexpr std::array<std::size_t, std::variant_size_v<InternalInputType>> Offsets{
+			0,
+			SDL_NUM_SCANCODES,
+			SDL_NUM_SCANCODES + std::to_underlying(Input::Mouse::MouseWheelY) + 1,
+			SDL_NUM_SCANCODES + std::to_underlying(Input::Mouse::MouseWheelY) + 1 + SDL_CONTROLLER_BUTTON_MAX,
+			SDL_NUM_SCANCODES + std::to_underlying(Input::Mouse::MouseWheelY) + 1 + SDL_CONTROLLER_BUTTON_MAX +
+			SDL_CONTROLLER_AXIS_MAX
+		};
+
+		/// The number of distinct physical inputs.
+		static constexpr std::size_t Size = Offsets.back() + std::to_underlying(Input::GamepadStick::Right) + 1;
+
+		/// @return A unique index for \p input, less than Size.
+		static constexpr std::size_t Pack(const InternalInputType& input)
+		{
+			return Offsets[input.index()] + std::visit([](auto value) { return static_cast<std::size_t>(value); }, input);
+		}
+
+		/// @return The input that Pack turned into \p packed, which must be less than Size.
+		static constexpr InternalInputType Unpack(std::size_t packed)
+		{
+			assert(packed < Size);
+			return UnpackFrom<0>(packed);
+		}
+
+	private:
+		template <std::size_t Index>
+		static constexpr InternalInputType UnpackFrom(std::size_t packed)
+		{
+			if constexpr (Index + 1 < Offsets.size())
+			{
+				if (packed >= Offsets[Index + 1]) { return UnpackFrom<Index + 1>(packed); }
+			}
+
+			using Alternative = std::variant_alternative_t<Index, InternalInputType>;
+			return InternalInputType{std::in_place_index<Index>, static_cast<Alternative>(packed - Offsets[Index])};
+		}
+
+		// Every binding in the order it was added, which the grouped table is rebuilt from when it changes.
+		std::vector<std::pair<std::size_t, Binding>> Added;
+
+		// The bindings for packed input i are [GroupOffsets[i], GroupOffsets[i + 1]) of Grouped.
+		std::vector<std::uint32_t> GroupOffsets = std::vector<std::uint32_t>(Size + 1, 0);
+		std::vector<Binding> Grouped;
+
+		// Where the next binding of each input goes while regrouping, kept so regrouping doesn't allocate.
+		std::vector<std::uint32_t> Next;
+
+		bool IsDirty = false;
+
+		void Rebuild()
+		{
+			// A counting sort by packed input, which keeps the bindings for each input in the order they were added.
+			std::ranges::fill(GroupOffsets, 0);
+			for (const auto& [input, binding] : Added) { ++GroupOffsets[input + 1]; }
+			for (std::size_t i = 1; i < GroupOffsets.size(); ++i) { GroupOffsets[i] += GroupOffsets[i - 1]; }
+
+			Grouped.resize(Added.size());
+			Next.assign(GroupOffsets.begin(), GroupOffsets.end() - 1);
+			for (const auto& [input, binding] : Added) { Grouped[Next[input]++] = binding; }
+
+			IsDirty = false;
+		}
+
+	public:
+		void Add(const InternalInputType& input, Binding binding)
+		{
+			Added.emplace_back(Pack(input), binding);
+			IsDirty = true;
+		}
+
+		/// Makes room for \p count more bindings, so adding them and regrouping doesn't reallocate.
+		void Reserve(std::size_t count)
+		{
+			// Grown geometrically, so reserving a little at a time doesn't reallocate every time.
+			if (Added.size() + count <= Added.capacity()) { return; }
+
+			Added.reserve(std::max(Added.size() + count, Added.capacity() * 2));
+			Grouped.reserve(Added.capacity());
+		}
+
+		/// Removes every binding, but keeps the memory for reuse.
+		void Clear()
+		{
+			Added.clear();
+			IsDirty = true;
+		}
+
+		/// Groups any bindings added since the last lookup now, rather than on the next.
+		void Regroup()
+		{
+			if (IsDirty) { Rebuild(); }
+		}
+
+		/// Regrouping is deferred until the first lookup after bindings are added, so adding many is still linear.
+		/// @return Every binding for \p input, in the order they were added.
+		std::span<const Binding> Find(const InternalInputType& input)
+		{
+			Regroup();
+
+			const std::size_t packed = Pack(input);
+			return std::span{Grouped}.subspan(GroupOffsets[packed], GroupOffsets[packed + 1] - GroupOffsets[packed]);
+		}
+	};
+}
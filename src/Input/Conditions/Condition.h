@@ -1,13 +1,40 @@
 #pragma once
+#include "PressedCondition.h"
+#include "ReleasedCondition.h"
+#include <memory>
+#include <variant>
 
 namespace Engine3
 {
 	class Input;
 
+	/// The base for user defined conditions, which are called through a pointer. The built in conditions aren't derived
+	/// from this, so they can be stored inline and called directly.
 	class Condition
 	{
 	public:
 		virtual ~Condition() = default;
 		virtual bool operator()(const Input &input) = 0;
+
+		/// Called when the input is stopped without being processed, e.g. by InputManager::SetProfile, so any state kept
+		/// between updates should be forgotten.
+		virtual void Reset() {}
 	};
-}
\ No newline at end of file
+
+	/// Adapts a user defined condition to be stored alongside the built in ones.
+	class CustomCondition
+	{
+	private:
+		std::unique_ptr<Condition> Pointer;
+
+	public:
+		explicit CustomCondition(std::unique_ptr<Condition> condition) : Pointer(std::move(condition)) {}
+
+		bool operator()(const Input& input) { return (*Pointer)(input); }
+
+		void Reset() { Pointer->Reset(); }
+	};
+
+	/// Every condition an input can have, with CustomCondition for anything that isn't built in.
+	using ConditionVariant = std::variant<PressedCondition, ReleasedCondition, CustomCondition>;
+}
@@ -1,22 +1,13 @@
 #pragma once
-#include "Condition.h"
-#include "../Action.h"
 
 namespace Engine3
 {
-	class PressedCondition : public Condition
+	class PressedCondition
 	{
-	private:
-		ProcessState PreviousProcessState = ProcessState::Stop;
-
 	public:
-		bool operator()(const Input& input) override
-		{
-			bool isHeld = input.GetCurrentState() == PreviousProcessState;
-			bool isPressed = !isHeld && input.GetCurrentState() != ProcessState::Release;
-			PreviousProcessState = input.GetCurrentState();
+		// A template as Input is incomplete here, it's only called once it isn't.
+		bool operator()(const auto& input) const { return input.WasPressed(); }
 
-			return isPressed;
-		}
+		void Reset() {}
 	};
 }
@@ -1,14 +1,13 @@
 #pragma once
-#include "Condition.h"
-#include "../Action.h"
+
 namespace Engine3
 {
-	class ReleasedCondition : public Condition
+	class ReleasedCondition
 	{
 	public:
-		bool operator()(const Input &input) override
-		{
-			return input.GetCurrentState() == ProcessState::Release;
-		}
+		// A template as Input is incomplete here, it's only called once it isn't.
+		bool operator()(const auto& input) const { return input.WasReleased(); }
+
+		void Reset() {}
 	};
-}
\ No newline at end of file
+}
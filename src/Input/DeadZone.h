@@ -0,0 +1,102 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <span>
+
+namespace Engine3
+{
+	/// How a stick's dead zone is measured. \n
+	/// https://web.archive.org/web/20190129113357/http://www.third-helix.com/2013/04/12/doing-thumbstick-dead-zones-right.html
+	enum class DeadZoneShape
+	{
+		/// Each axis on its own, which snaps the stick to the axes near the centre.
+		Axial,
+		/// The stick's distance from the centre, which jumps from zero to the dead zone once outside it.
+		Radial,
+		/// Radial, with the range outside the dead zone stretched back to start from zero, so there's no jump.
+		ScaledRadial
+	};
+
+	/// Filters out the noise of a stick at rest, and shapes how its distance from the centre maps to the value used. \n
+	/// Applies to a whole batch of sticks at once, structure of arrays, so a frame of every controller is one pass.
+	struct DeadZone
+	{
+		DeadZoneShape Shape = DeadZoneShape::ScaledRadial;
+
+		/// Values no further than this from the centre are zero.
+		float Inner = 0.2f;
+
+		/// Values at least this far from the centre are treated as fully pushed by ScaledRadial, as worn sticks often
+		/// don't reach the edge.
+		float Outer = 1.f;
+
+		/// Applied to the distance from the centre after the dead zone, from zero to one, keeping the direction. \n
+		/// Null, the default, leaves it linear.
+		float (*ResponseCurve)(float) = nullptr;
+
+		void operator()(float& value) const
+		{
+			const float magnitude = Shape == DeadZoneShape::ScaledRadial
+				                        ? Scale(std::abs(value))
+				                        : Threshold(std::abs(value));
+			const float curved = ResponseCurve && magnitude > 0 ? ResponseCurve(magnitude) : magnitude;
+			value = std::copysign(curved, value);
+		}
+
+		void operator()(float& x, float& y) const { (*this)(std::span{&x, 1}, std::span{&y, 1}); }
+
+		/// Applies to each stick (\p x[i], \p y[i]) in place.
+		void operator()(std::span<float> x, std::span<float> y) const
+		{
+			assert(x.size() == y.size());
+
+			// The shape is picked outside the loops so each is branch free and can be vectorised.
+			switch (Shape)
+			{
+			case DeadZoneShape::Axial:
+				for (std::size_t i = 0; i < x.size(); ++i)
+				{
+					x[i] = Threshold(std::abs(x[i])) > 0 ? x[i] : 0;
+					y[i] = Threshold(std::abs(y[i])) > 0 ? y[i] : 0;
+				}
+				break;
+			case DeadZoneShape::Radial:
+				for (std::size_t i = 0; i < x.size(); ++i)
+				{
+					const float scale = x[i] * x[i] + y[i] * y[i] > Inner * Inner ? 1.f : 0.f;
+					x[i] *= scale;
+					y[i] *= scale;
+				}
+				break;
+			case DeadZoneShape::ScaledRadial:
+				for (std::size_t i = 0; i < x.size(); ++i)
+				{
+					// From the original length to the scaled length, guarding against dividing by a zero length.
+					const float length = std::sqrt(x[i] * x[i] + y[i] * y[i]);
+					const float scale = length > Inner ? Scale(length) / length : 0.f;
+					x[i] *= scale;
+					y[i] *= scale;
+				}
+				break;
+			}
+
+			if (!ResponseCurve) { return; }
+
+			for (std::size_t i = 0; i < x.size(); ++i)
+			{
+				const float length = std::sqrt(x[i] * x[i] + y[i] * y[i]);
+				if (length == 0) { continue; }
+
+				const float scale = ResponseCurve(std::min(length, 1.f)) / length;
+				x[i] *= scale;
+				y[i] *= scale;
+			}
+		}
+
+	private:
+		float Threshold(float magnitude) const { return magnitude > Inner ? magnitude : 0.f; }
+
+		float Scale(float magnitude) const { return std::clamp((magnitude - Inner) / (Outer - Inner), 0.f, 1.f); }
+	};
+}
@@ -0,0 +1,197 @@
+#include "InputLog.h"
+#include "BindingTable.h"
+#include "../Utility/Varint.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <iterator>
+#include <print>
+#include <utility>
+
+namespace
+{
+	constexpr std::array<std::uint8_t, 5> Header{'E', '3', 'I', 'L', 1};
+
+	// Each record's state, the alternative its value holds and whether it has a device are packed into one byte.
+	constexpr std::uint8_t StateMask = 0b11;
+	constexpr std::uint8_t ValueShift = 2;
+	constexpr std::uint8_t ValueMask = 0b11;
+	constexpr std::uint8_t HasDeviceFlag = 1 << 4;
+	constexpr std::uint8_t HasPlayerFlag = 1 << 5;
+
+	void WriteFloat(float value, std::vector<std::uint8_t>& out)
+	{
+		// Little endian regardless of the platform, so a log can be played back anywhere.
+		const auto bits = std::bit_cast<std::uint32_t>(value);
+		for (int i = 0; i < 4; ++i) { out.push_back(static_cast<std::uint8_t>(bits >> (8 * i))); }
+	}
+
+	bool ReadFloat(std::span<const std::uint8_t>& in, float& value)
+	{
+		if (in.size() < 4) { return false; }
+
+		std::uint32_t bits = 0;
+		for (int i = 0; i < 4; ++i) { bits |= static_cast<std::uint32_t>(in[i]) << (8 * i); }
+		value = std::bit_cast<float>(bits);
+		in = in.subspan(4);
+		return true;
+	}
+
+	bool ReadRecord(std::span<const std::uint8_t>& in, Engine3::InputRecord::Clock::time_point& timestamp,
+	                Engine3::InputRecord& record)
+	{
+		using namespace Engine3;
+
+		std::uint64_t delta, packed;
+		if (!ReadVarint(in, delta) || !ReadVarint(in, packed) || packed >= BindingTable::Size || in.empty())
+		{
+			return false;
+		}
+
+		const std::uint8_t flags = in[0];
+		in = in.subspan(1);
+		if ((flags & StateMask) > std::to_underlying(ProcessState::Release)) { return false; }
+
+		timestamp += InputRecord::Clock::duration{ZigZagDecode(delta)};
+		record.Timestamp = timestamp;
+		record.Input = BindingTable::Unpack(packed);
+		record.State = static_cast<ProcessState>(flags & StateMask);
+
+		switch ((flags >> ValueShift) & ValueMask)
+		{
+		case 0:
+			record.Value = std::monostate{};
+			break;
+		case 1:
+			{
+				float value;
+				if (!ReadFloat(in, value)) { return false; }
+				record.Value = value;
+				break;
+			}
+		case 2:
+			{
+				float x, y;
+				if (!ReadFloat(in, x) || !ReadFloat(in, y)) { return false; }
+				record.Value = Vector<2>{x, y};
+				break;
+			}
+		default:
+			return false;
+		}
+
+		record.Device = InputRecord::NoDevice;
+		if (flags & HasDeviceFlag)
+		{
+			std::uint64_t device;
+			if (!ReadVarint(in, device)) { return false; }
+			record.Device = static_cast<std::int32_t>(ZigZagDecode(device));
+		}
+
+		record.Player = Input::AnyPlayer;
+		if (flags & HasPlayerFlag)
+		{
+			std::uint64_t player;
+			if (!ReadVarint(in, player)) { return false; }
+			record.Player = static_cast<std::int32_t>(ZigZagDecode(player));
+		}
+
+		return true;
+	}
+}
+
+Engine3::InputRecorder::InputRecorder(std::ostream& out) : Out(out)
+{
+	Out.write(reinterpret_cast<const char*>(Header.data()), Header.size());
+}
+
+void Engine3::InputRecorder::Record(const InputRecord& record)
+{
+	const InputRecord::Clock::duration delta = HasRecorded
+		                                           ? record.Timestamp - PreviousTimestamp
+		                                           : InputRecord::Clock::duration::zero();
+	PreviousTimestamp = record.Timestamp;
+	HasRecorded = true;
+
+	WriteVarint(ZigZagEncode(delta.count()), Records);
+	WriteVarint(BindingTable::Pack(record.Input), Records);
+
+	std::uint8_t flags = std::to_underlying(record.State);
+	flags |= static_cast<std::uint8_t>(record.Value.index() << ValueShift);
+	if (record.Device != InputRecord::NoDevice) { flags |= HasDeviceFlag; }
+	if (record.Player != Input::AnyPlayer) { flags |= HasPlayerFlag; }
+	Records.push_back(flags);
+
+	if (const float* value = std::get_if<float>(&record.Value)) { WriteFloat(*value, Records); }
+	else if (const Vector<2>* vector = std::get_if<Vector<2>>(&record.Value))
+	{
+		WriteFloat(vector->X(), Records);
+		WriteFloat(vector->Y(), Records);
+	}
+
+	if (record.Device != InputRecord::NoDevice) { WriteVarint(ZigZagEncode(record.Device), Records); }
+	if (record.Player != Input::AnyPlayer) { WriteVarint(ZigZagEncode(record.Player), Records); }
+
+	++RecordCount;
+}
+
+void Engine3::InputRecorder::EndFrame()
+{
+	Buffer.clear();
+	WriteVarint(RecordCount, Buffer);
+	Buffer.insert(Buffer.end(), Records.begin(), Records.end());
+	Out.write(reinterpret_cast<const char*>(Buffer.data()), static_cast<std::streamsize>(Buffer.size()));
+
+	Records.clear();
+	RecordCount = 0;
+}
+
+bool Engine3::InputPlayer::Load(std::istream& in, InputRecord::Clock::time_point start)
+{
+	Records.clear();
+	FrameEnds.clear();
+	Frame = 0;
+
+	const std::vector<std::uint8_t> bytes{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+	std::span<const std::uint8_t> remaining{bytes};
+	if (remaining.size() < Header.size() || !std::ranges::equal(remaining.first(Header.size()), Header))
+	{
+		std::print("Error! Not an input log!\n");
+		return false;
+	}
+	remaining = remaining.subspan(Header.size());
+
+	InputRecord::Clock::time_point timestamp = start;
+	while (!remaining.empty())
+	{
+		std::uint64_t count;
+		bool isValid = ReadVarint(remaining, count);
+		for (std::uint64_t i = 0; isValid && i < count; ++i)
+		{
+			isValid = ReadRecord(remaining, timestamp, Records.emplace_back());
+		}
+
+		if (!isValid)
+		{
+			std::print("Error! Input log is truncated or corrupt!\n");
+			Records.clear();
+			FrameEnds.clear();
+			return false;
+		}
+
+		FrameEnds.push_back(Records.size());
+	}
+
+	return true;
+}
+
+std::span<const Engine3::InputRecord> Engine3::InputPlayer::NextFrame()
+{
+	if (IsFinished()) { return {}; }
+
+	const std::size_t begin = Frame == 0 ? 0 : FrameEnds[Frame - 1];
+	const std::size_t end = FrameEnds[Frame];
+	++Frame;
+
+	return std::span{Records}.subspan(begin, end - begin);
+}
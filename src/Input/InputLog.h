@@ -0,0 +1,71 @@
+#pragma once
+#include "InputRecord.h"
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <span>
+#include <vector>
+
+namespace Engine3
+{
+	/// Writes every input handled, frame by frame, to a compact binary log that InputPlayer can play back. \n
+	/// Pass each record to Record from Events::SetInputCallback, and call EndFrame after each Events::Process. Each
+	/// frame is a varint count of its records followed by them, each being little more than a few varints, so a frame
+	/// without input takes a single byte.
+	class InputRecorder
+	{
+	private:
+		std::ostream& Out;
+
+		std::vector<std::uint8_t> Records;
+		std::vector<std::uint8_t> Buffer;
+		std::size_t RecordCount = 0;
+
+		// Timestamps are written relative to the one before, so they're small and independent of when recording started.
+		InputRecord::Clock::time_point PreviousTimestamp{};
+		bool HasRecorded = false;
+
+	public:
+		/* CONSTRUCTORS */
+		/// Writes the log's header to \p out, which must outlive the recorder.
+		explicit InputRecorder(std::ostream& out);
+
+		/* METHODS */
+		/// Adds \p record to the current frame.
+		void Record(const InputRecord& record);
+
+		/// Writes the current frame, with every record since the last, to the stream in one go.
+		void EndFrame();
+	};
+
+	/// Plays back a log written by InputRecorder a frame at a time, for Events::Replay to handle exactly as the
+	/// original input was, without SDL or anyone at the controls.
+	class InputPlayer
+	{
+	private:
+		std::vector<InputRecord> Records;
+
+		// The records of frame i end at FrameEnds[i], and start where the previous frame's ended.
+		std::vector<std::size_t> FrameEnds;
+
+		std::size_t Frame = 0;
+
+	public:
+		/* METHODS */
+		/// Reads a whole log, replacing anything read before, so playback doesn't wait on reading the stream. \n
+		/// Timestamps keep the spacing they were recorded with, starting from \p start.
+		/// @return False, leaving nothing to play, if \p in isn't a complete log.
+		bool Load(std::istream& in, InputRecord::Clock::time_point start = InputRecord::Clock::now());
+
+		std::size_t GetFrameCount() const { return FrameEnds.size(); }
+
+		bool IsFinished() const { return Frame == FrameEnds.size(); }
+
+		/// @return The records of the next frame, which may be none, and then moves on to the frame after.
+		std::span<const InputRecord> NextFrame();
+
+		/// Starts playing back from the first frame again.
+		void Rewind() { Frame = 0; }
+	};
+}
@@ -1,42 +1,231 @@
 #pragma once
 #include "Action.h"
+#include "BindingProfile.h"
+#include "BindingSet.h"
+#include "BindingTable.h"
 #include "../Maths/Vector.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <variant>
 #include <vector>
 
 namespace Engine3
 {
-	template <typename... T>
-	concept IsFloat = (std::same_as<T, float> || ...);
-
-	template <typename... T>
-	concept IsVector2 = (std::same_as<T, Vector<2>> || ...);
-
-	template <typename... T>
-	concept IsValidType = (IsFloat<T...> || IsVector2<T...>);
-
 	class InputManager
 	{
-		friend class Events;
+		friend class Action;
 
 	private:
 		std::vector<std::unique_ptr<Action>> Actions;
 
-		void Update(InternalInputType type, ProcessState state, InputValue value) const
+		// Double buffered, so a profile's bindings are built while the current ones are still in use, then swapped in
+		// between frames. Both keep their memory, so switching back and forth doesn't allocate.
+		std::array<BindingTable, 2> BindingTables;
+
+		BindingTable* Bindings = &BindingTables[0];
+
+		BindingTable* PendingBindings = &BindingTables[1];
+
+		bool HasPendingBindings = false;
+
+		// The actions with an input that's been updated or is still held, which are the only ones that need processing.
+		// Idle actions then cost nothing per frame, however many are registered.
+		// Each is paired with its order, so they can be sorted without reaching into every action.
+		std::vector<std::pair<std::size_t, Action*>> ActiveActions;
+
+		std::vector<std::pair<std::size_t, Action*>> Processing;
+
+		void Queue(Action& action)
+		{
+			if (action.IsQueued) { return; }
+
+			action.IsQueued = true;
+			ActiveActions.emplace_back(action.Order, &action);
+		}
+
+		void Bind(const InternalInputType& type, Binding binding)
+		{
+			Bindings->Add(type, binding);
+			if (HasPendingBindings) { PendingBindings->Add(type, binding); }
+		}
+
+		void SwapBindings()
 		{
-			for (auto& action : Actions) { action->Update(type, state, value); }
+			std::swap(Bindings, PendingBindings);
+			HasPendingBindings = false;
+
+			// Whatever held them may no longer be bound to them, so they'd never be released.
+			for (const auto& [order, action] : ActiveActions)
+			{
+				action->StopInputs();
+				action->IsQueued = false;
+			}
+
+			ActiveActions.clear();
 		}
 
-		void Process() const { for (const auto& action : Actions) { action->Process(); } }
+		template <class... Descriptions, std::size_t... Index>
+		std::array<Action*, sizeof...(Descriptions)> AddActions(const BindingSet<Descriptions...>& bindings,
+		                                                        std::index_sequence<Index...>,
+		                                                        typename Descriptions::Function... functions)
+		{
+			return {&AddAction(std::get<Index>(bindings.ActionBindings), std::move(functions))...};
+		}
 
 	public:
+		/* CONSTRUCTORS */
+		InputManager() = default;
+
+		/* COPY AND MOVE OPERATIONS*/
+		// Every action refers back to the manager that owns it, so it can't be moved.
+		InputManager(const InputManager& other) = delete;
+
+		InputManager(InputManager&& other) noexcept = delete;
+
+		InputManager& operator=(const InputManager& other) = delete;
+
+		InputManager& operator=(InputManager&& other) noexcept = delete;
+
+		/* METHODS */
 		template <IsValidType ...T>
 			requires (sizeof...(T) == 0 ||
 				(sizeof...(T) == 1))
 		Action& AddAction(std::function<void(T...)> function, bool cumulateInputs = false)
 		{
-			return *Actions.emplace_back(new Implementation::Action(std::move(function), cumulateInputs)).get();
+			Action& action = *Actions.emplace_back(new Implementation::Action(*this, std::move(function), cumulateInputs));
+			action.Order = Actions.size() - 1;
+			return action;
+		}
+
+		/// Adds the action \p binding describes, with room for all of its inputs made up front.
+		template <std::size_t Count, IsValidType... T>
+		Action& AddAction(const ActionBinding<Count, T...>& binding, std::function<void(T...)> function)
+		{
+			Action& action = AddAction(std::move(function), binding.CumulateInputs);
+			action.Reserve(Count);
+
+			// Duplicates were ruled out when the binding was described.
+			for (const InputBinding& description : binding.Inputs)
+			{
+				Input& input = action.AppendInput(description.Type, description.Player);
+				for (std::size_t i = 0; i < description.ModifierCount; ++i)
+				{
+					std::visit([&input]<typename M>(const M& modifier) { input.AddModifier<M>(modifier); },
+					           description.Modifiers[i]);
+				}
+
+				for (std::size_t i = 0; i < description.ConditionCount; ++i)
+				{
+					std::visit([&input]<typename C>(const C& condition) { input.AddCondition<C>(condition); },
+					           description.Conditions[i]);
+				}
+			}
+
+			return action;
+		}
+
+		/// Adds every action \p bindings describes, in order, making room for all of them and their inputs first, so
+		/// nothing is reallocated as they're added however many there are.
+		/// @param functions The function of each action, in the same order.
+		/// @return Each action added, in the same order.
+		template <class... Descriptions>
+		std::array<Action*, sizeof...(Descriptions)> AddActions(const BindingSet<Descriptions...>& bindings,
+		                                                        typename Descriptions::Function... functions)
+		{
+			// Grown geometrically, as reserving exactly would reallocate on every call when adding many sets.
+			const std::size_t count = Actions.size() + bindings.ActionCount;
+			if (count > Actions.capacity())
+			{
+				Actions.reserve(std::max(count, Actions.capacity() * 2));
+				ActiveActions.reserve(Actions.capacity());
+				Processing.reserve(Actions.capacity());
+			}
+
+			Bindings->Reserve(bindings.InputCount);
+
+			return AddActions(bindings, std::index_sequence_for<Descriptions...>{}, std::move(functions)...);
+		}
+
+		/// Sets the state of every input bound to \p type, which is acted upon by the next Process.
+		/// @param player The player index of the controller it's from, or Input::AnyPlayer, which only updates the
+		/// inputs bound for any player.
+		void Update(const InternalInputType& type, ProcessState state, InputValue value,
+		            std::int32_t player = Input::AnyPlayer)
+		{
+			for (const Binding& binding : Bindings->Find(type))
+			{
+				if (binding.Player != Input::AnyPlayer && binding.Player != player) { continue; }
+
+				binding.BoundAction->Update(binding.Input, state, value);
+				Queue(*binding.BoundAction);
+			}
+		}
+
+		/// @return Whether any action has an input bound to \p type, so updating it would do anything.
+		bool IsBound(const InternalInputType& type) { return !Bindings->Find(type).empty(); }
+
+		/// Calls each action's function if any of its inputs are active. \n
+		/// Only actions with an input updated since, or held through, the last Process are visited.
+		void Process()
+		{
+			// Swapped out so an action's function can update inputs, queueing actions for the next Process.
+			std::swap(ActiveActions, Processing);
+
+			// Those still active from the last Process are already in order, so often there's nothing to sort.
+			if (!std::ranges::is_sorted(Processing)) { std::ranges::sort(Processing); }
+
+			for (const auto& [order, action] : Processing)
+			{
+				action->Process();
+
+				if (action->RemoveStoppedInputs()) { ActiveActions.emplace_back(order, action); }
+				else { action->IsQueued = false; }
+			}
+
+			Processing.clear();
+
+			if (HasPendingBindings) { SwapBindings(); }
+		}
+
+		/// Rebinds every action's inputs to \p profile's rebindings, or what they were added with where it has none,
+		/// without touching the actions. \n
+		/// The new bindings are built now, and swapped in at the end of the next Process, so every input of a frame goes
+		/// through the same bindings, and an action can change the profile. Inputs still held then are stopped, and must
+		/// be pressed again. Rebindings of actions or inputs that don't exist are ignored.
+		void SetProfile(const BindingProfile& profile)
+		{
+			PendingBindings->Clear();
+
+			// Both are in order, so the rebindings are walked alongside the actions.
+			const std::span<const Rebinding> rebindings = profile.GetRebindings();
+			auto rebinding = rebindings.begin();
+			for (const std::unique_ptr<Action>& action : Actions)
+			{
+				for (std::uint32_t input = 0; input < action->Inputs.size(); ++input)
+				{
+					while (rebinding != rebindings.end() && std::pair{rebinding->ActionIndex, rebinding->InputIndex} <
+						std::pair{static_cast<std::uint32_t>(action->Order), input})
+					{
+						++rebinding;
+					}
+
+					const bool isRebound = rebinding != rebindings.end() && rebinding->ActionIndex == action->Order &&
+						rebinding->InputIndex == input;
+					const InternalInputType& type = isRebound ? rebinding->Type : action->Types[input];
+					const std::int32_t player = isRebound ? rebinding->Player : action->Players[input];
+					PendingBindings->Add(type, {action.get(), input, player});
+				}
+			}
+
+			PendingBindings->Regroup();
+			HasPendingBindings = true;
 		}
 	};
 }
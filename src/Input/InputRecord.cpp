@@ -0,0 +1,100 @@
+#include "InputRecord.h"
+#include <limits>
+#include <utility>
+
+namespace
+{
+	Engine3::Input::Mouse GetMouseButtonName(const SDL_Event& event)
+	{
+		switch (event.button.button)
+		{
+		case SDL_BUTTON_LEFT:
+			return Engine3::Input::Mouse::Left;
+		case SDL_BUTTON_MIDDLE:
+			return Engine3::Input::Mouse::Middle;
+		case SDL_BUTTON_RIGHT:
+			return Engine3::Input::Mouse::Right;
+		case SDL_BUTTON_X1:
+			return Engine3::Input::Mouse::Extra1;
+		case SDL_BUTTON_X2:
+			return Engine3::Input::Mouse::Extra2;
+		default:
+			std::unreachable();
+		}
+	}
+
+	float GetAxisValue(Sint16 value)
+	{
+		return value < 0
+			       ? -static_cast<float>(value) / std::numeric_limits<Sint16>::min()
+			       : static_cast<float>(value) / std::numeric_limits<Sint16>::max();
+	}
+}
+
+Engine3::InputRecord::Clock::time_point Engine3::InputRecord::GetTimestamp(const SDL_Event& event)
+{
+	// SDL stamps events with its ticks, the milliseconds since it started, so they're offset by when that was. The
+	// offset is only taken once, so the timestamps keep to SDL's clock rather than drifting with when this is called.
+	static const Clock::time_point ticksStart = Clock::now() - std::chrono::milliseconds{SDL_GetTicks64()};
+
+	// The timestamp is only 32 bits, which wrap after 49 days, so the rest are taken from the current ticks as it's never
+	// later than them.
+	const Uint64 now = SDL_GetTicks64();
+	const Uint64 ticks = now - static_cast<Uint32>(static_cast<Uint32>(now) - event.common.timestamp);
+	return ticksStart + std::chrono::milliseconds{ticks};
+}
+
+std::size_t Engine3::InputRecord::FromEvent(const SDL_Event& event, std::span<InputRecord, MaximumPerEvent> records)
+{
+	const Clock::time_point timestamp = GetTimestamp(event);
+
+	switch (event.type) // SDL_EventType
+	{
+	case SDL_KEYDOWN:
+		records[0] = {timestamp, event.key.keysym.scancode, ProcessState::Continuous, {}};
+		return 1;
+	case SDL_KEYUP:
+		records[0] = {timestamp, event.key.keysym.scancode, ProcessState::Release, {}};
+		return 1;
+	case SDL_MOUSEMOTION:
+		records[0] = {timestamp, Input::Mouse::MouseAxisX, ProcessState::Once, static_cast<float>(event.motion.xrel)};
+		records[1] = {timestamp, Input::Mouse::MouseAxisY, ProcessState::Once, static_cast<float>(event.motion.yrel)};
+		return 2;
+	case SDL_MOUSEBUTTONDOWN:
+		records[0] = {
+			timestamp, GetMouseButtonName(event), ProcessState::Continuous,
+			Vector<2>{static_cast<float>(event.button.x), static_cast<float>(event.button.y)}
+		};
+		return 1;
+	case SDL_MOUSEBUTTONUP:
+		records[0] = {
+			timestamp, GetMouseButtonName(event), ProcessState::Release,
+			Vector<2>{static_cast<float>(event.button.x), static_cast<float>(event.button.y)}
+		};
+		return 1;
+	case SDL_MOUSEWHEEL:
+		records[0] = {timestamp, Input::Mouse::MouseWheelX, ProcessState::Once, event.wheel.preciseX};
+		records[1] = {timestamp, Input::Mouse::MouseWheelY, ProcessState::Once, event.wheel.preciseY};
+		return 2;
+	case SDL_CONTROLLERBUTTONDOWN:
+		records[0] = {
+			timestamp, static_cast<SDL_GameControllerButton>(event.cbutton.button), ProcessState::Continuous, {},
+			event.cbutton.which
+		};
+		return 1;
+	case SDL_CONTROLLERBUTTONUP:
+		records[0] = {
+			timestamp, static_cast<SDL_GameControllerButton>(event.cbutton.button), ProcessState::Release, {},
+			event.cbutton.which
+		};
+		return 1;
+	case SDL_CONTROLLERAXISMOTION:
+		records[0] = {
+			timestamp, static_cast<SDL_GameControllerAxis>(event.caxis.axis), ProcessState::Continuous,
+			GetAxisValue(event.caxis.value), event.caxis.which
+		};
+		return 1;
+	default:
+		return 0;
+	}
+}
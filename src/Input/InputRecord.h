@@ -0,0 +1,42 @@
+#pragma once
+#include "Action.h"
+#include "ProcessState.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace Engine3
+{
+	/// A change to one physical input, and when it happened.
+	struct InputRecord
+	{
+		using Clock = std::chrono::steady_clock;
+
+		/// The device of keyboard and mouse inputs, which aren't told apart.
+		static constexpr std::int32_t NoDevice = -1;
+
+		/// The most records a single event is split into.
+		static constexpr std::size_t MaximumPerEvent = 2;
+
+		Clock::time_point Timestamp;
+		InternalInputType Input;
+		ProcessState State;
+		InputValue Value;
+
+		/// The instance ID of the controller it came from, or NoDevice.
+		std::int32_t Device = NoDevice;
+
+		/// The player index of the controller it came from, or Input::AnyPlayer. Only known once it reaches Events, as
+		/// that's what assigns them.
+		std::int32_t Player = Input::AnyPlayer;
+
+		/// Converts an SDL input event into the records it's made up of, such as mouse motion into one per axis. \n
+		/// Each is stamped with when SDL queued the event, to the millisecond, rather than when it's converted.
+		/// @return The number of records written to \p records, which is zero if \p event isn't an input.
+		static std::size_t FromEvent(const SDL_Event& event, std::span<InputRecord, MaximumPerEvent> records);
+
+		/// @return When SDL queued \p event, on Clock.
+		static Clock::time_point GetTimestamp(const SDL_Event& event);
+	};
+}
@@ -1,32 +1,34 @@
 #pragma once
-#include "Modifier.h"
+#include "../DeadZone.h"
 #include "../../Maths/Vector.h"
 
 namespace Engine3
 {
 	// While it would be nicer to have this as a condition so that input doesn't occur continuously,
 	// to handle the Vector2 case it would mean that the deadzone of one of the axes would not be taken into account.
-	class DeadZoneModifier : public Modifier
+	// For sticks, bind Input::GamepadStick rather than each axis, so both axes are seen together.
+	class DeadZoneModifier
 	{
 	private:
-		float DeadZone;
+		DeadZone Zone;
 
 	public:
-		DeadZoneModifier() : DeadZone(0.2f) {}
+		constexpr DeadZoneModifier() : Zone{DeadZoneShape::Radial} {}
 
-		DeadZoneModifier(float deadZone) : DeadZone(deadZone) {}
+		constexpr DeadZoneModifier(float deadZone) : Zone{DeadZoneShape::Radial, deadZone} {}
 
-		void operator()(float& value) override
-		{
-			// Axial, effectively.
-			value = std::abs(value) > DeadZone ? value : 0;
-		}
+		constexpr DeadZoneModifier(float deadZone, DeadZoneShape shape) : Zone{shape, deadZone} {}
+
+		explicit constexpr DeadZoneModifier(const DeadZone& deadZone) : Zone(deadZone) {}
+
+		void operator()(float& value) { Zone(value); }
 
-		void operator()(Vector<2>& value) override
+		void operator()(Vector<2>& value)
 		{
-			// https://web.archive.org/web/20190129113357/http://www.third-helix.com/2013/04/12/doing-thumbstick-dead-zones-right.html
-			value.X(std::abs(value.X()) > DeadZone ? value.X() : 0);
-			value.Y(std::abs(value.Y()) > DeadZone ? value.Y() : 0);
+			float x = value.X();
+			float y = value.Y();
+			Zone(x, y);
+			value = {x, y};
 		}
 	};
 }
@@ -1,8 +1,14 @@
 #pragma once
+#include "DeadZoneModifier.h"
+#include "SwizzleModifier.h"
 #include "../../Maths/Vector.h"
+#include <memory>
+#include <variant>
 
 namespace Engine3
 {
+	/// The base for user defined modifiers, which are called through a pointer. The built in modifiers aren't derived
+	/// from this, so they can be stored inline and called directly.
 	class Modifier
 	{
 	public:
@@ -13,4 +19,20 @@ namespace Engine3
 		virtual void operator()(Vector<2> &value) = 0;
 	};
 
-}
\ No newline at end of file
+	/// Adapts a user defined modifier to be stored alongside the built in ones.
+	class CustomModifier
+	{
+	private:
+		std::unique_ptr<Modifier> Pointer;
+
+	public:
+		explicit CustomModifier(std::unique_ptr<Modifier> modifier) : Pointer(std::move(modifier)) {}
+
+		void operator()(float& value) { (*Pointer)(value); }
+
+		void operator()(Vector<2>& value) { (*Pointer)(value); }
+	};
+
+	/// Every modifier an input can have, with CustomModifier for anything that isn't built in.
+	using ModifierVariant = std::variant<DeadZoneModifier, SwizzleModifier, CustomModifier>;
+}
@@ -1,14 +1,13 @@
 #pragma once
-#include "Modifier.h"
 #include "../../Maths/Vector.h"
 
 namespace Engine3
 {
-	class SwizzleModifier : public Modifier
+	class SwizzleModifier
 	{
 	public:
-		void operator()(float &value) override {} // Do nothing, doesn't make sense to swizzle a float.
-		void operator()(Vector<2> &value) override
+		void operator()(float &value) {} // Do nothing, doesn't make sense to swizzle a float.
+		void operator()(Vector<2> &value)
 		{
 			value = { value.Y(), value.X()};
 		}
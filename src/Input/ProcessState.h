@@ -0,0 +1,12 @@
+#pragma once
+
+namespace Engine3
+{
+	enum class ProcessState
+	{
+		Stop,
+		Once,
+		Continuous,
+		Release
+	};
+}
@@ -0,0 +1,161 @@
+#include "JobSystem.h"
+#include <cassert>
+
+namespace
+{
+	// Which system the current thread is a worker of, if any, and the queue it owns.
+	thread_local const Engine3::JobSystem* WorkerSystem = nullptr;
+	thread_local std::size_t WorkerQueue = 0;
+}
+
+Engine3::JobSystem::JobSystem(std::size_t threadCount)
+{
+	assert(threadCount > 0);
+
+	Queues.reserve(threadCount);
+	for (std::size_t i = 0; i < threadCount; ++i) { Queues.push_back(std::make_unique<Queue>()); }
+
+	// The first queue belongs to the threads that aren't workers.
+	Workers.reserve(threadCount - 1);
+	for (std::size_t i = 1; i < threadCount; ++i)
+	{
+		Workers.emplace_back([this, i](std::stop_token stopToken) { WorkerLoop(stopToken, i); });
+	}
+}
+
+Engine3::JobSystem::~JobSystem()
+{
+	// Stop every worker before joining any, so they wind down together rather than one at a time.
+	for (std::jthread& worker : Workers) { worker.request_stop(); }
+	Workers.clear();
+}
+
+std::size_t Engine3::JobSystem::CurrentQueue() const { return WorkerSystem == this ? WorkerQueue : 0; }
+
+void Engine3::JobSystem::Push(std::size_t queue, Job job)
+{
+	{
+		std::scoped_lock lock{Queues[queue]->Mutex};
+		Queues[queue]->Jobs.push_back(std::move(job));
+	}
+
+	// Incremented under the sleep mutex so a worker can't check it, then miss the notification before sleeping.
+	{
+		std::scoped_lock lock{SleepMutex};
+		QueuedJobs.fetch_add(1, std::memory_order_relaxed);
+	}
+	Wake.notify_one();
+}
+
+bool Engine3::JobSystem::TryPop(std::size_t queue, Job& job)
+{
+	std::scoped_lock lock{Queues[queue]->Mutex};
+	if (Queues[queue]->Jobs.empty()) { return false; }
+
+	job = std::move(Queues[queue]->Jobs.back());
+	Queues[queue]->Jobs.pop_back();
+	QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+
+	return true;
+}
+
+bool Engine3::JobSystem::TrySteal(std::size_t thief, Job& job)
+{
+	// Starting from the next queue along spreads thieves across victims, rather than all of them hitting the first.
+	for (std::size_t i = 1; i < Queues.size(); ++i)
+	{
+		Queue& victim = *Queues[(thief + i) % Queues.size()];
+
+		std::scoped_lock lock{victim.Mutex};
+		if (victim.Jobs.empty()) { continue; }
+
+		job = std::move(victim.Jobs.front());
+		victim.Jobs.pop_front();
+		QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+
+		return true;
+	}
+
+	return false;
+}
+
+bool Engine3::JobSystem::TryRunOne(std::size_t queue)
+{
+	Job job;
+	if (!TryPop(queue, job) && !TrySteal(queue, job)) { return false; }
+
+	Execute(job);
+	return true;
+}
+
+void Engine3::JobSystem::Execute(Job& job)
+{
+	job.Function();
+
+	// Decremented under the lock so that a dependent added concurrently either sees the count at zero and queues
+	// itself, or is already in the list when the last job takes it.
+	JobCounter& counter = *job.Counter;
+	decltype(counter.Continuations) continuations;
+	{
+		std::scoped_lock lock{counter.ContinuationsMutex};
+		if (counter.Count.fetch_sub(1, std::memory_order_acq_rel) == 1) { continuations.swap(counter.Continuations); }
+	}
+
+	// The counter may already have been destroyed by a waiter, so only the local copy can be used from here.
+	const std::size_t queue = CurrentQueue();
+	for (auto& [function, continuationCounter] : continuations)
+	{
+		Push(queue, {std::move(function), continuationCounter});
+	}
+}
+
+void Engine3::JobSystem::WorkerLoop(std::stop_token stopToken, std::size_t queue)
+{
+	WorkerSystem = this;
+	WorkerQueue = queue;
+
+	while (!stopToken.stop_requested())
+	{
+		if (TryRunOne(queue)) { continue; }
+
+		std::unique_lock lock{SleepMutex};
+		Wake.wait(lock, stopToken, [this] { return QueuedJobs.load(std::memory_order_relaxed) > 0; });
+	}
+}
+
+void Engine3::JobSystem::Run(std::function<void()> function, JobCounter& counter)
+{
+	counter.Count.fetch_add(1, std::memory_order_relaxed);
+	Push(CurrentQueue(), {std::move(function), &counter});
+}
+
+void Engine3::JobSystem::Run(std::function<void()> function, JobCounter& counter, JobCounter& dependency)
+{
+	// Counted straight away so waiting on the counter also waits for the dependency.
+	counter.Count.fetch_add(1, std::memory_order_relaxed);
+
+	{
+		std::scoped_lock lock{dependency.ContinuationsMutex};
+		if (!dependency.IsDone())
+		{
+			dependency.Continuations.emplace_back(std::move(function), &counter);
+			return;
+		}
+	}
+
+	Push(CurrentQueue(), {std::move(function), &counter});
+}
+
+void Engine3::JobSystem::Wait(JobCounter& counter)
+{
+	const std::size_t queue = CurrentQueue();
+	while (!counter.IsDone())
+	{
+		// Nothing left to help with, so the remaining jobs are already running on other threads.
+		if (!TryRunOne(queue)) { std::this_thread::yield(); }
+	}
+
+	// The last job may still hold the lock after the count reaches zero, so wait for it to let go before the counter
+	// can be destroyed.
+	std::scoped_lock lock{counter.ContinuationsMutex};
+}
@@ -0,0 +1,140 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Engine3
+{
+	class JobSystem;
+
+	/// Counts the jobs run against it that haven't finished yet, so a group of jobs can be waited on or depended on
+	/// as a whole. \n
+	/// Must outlive every job run against it and every job that depends on it, which is guaranteed once
+	/// JobSystem::Wait has returned for it.
+	class JobCounter
+	{
+		friend class JobSystem;
+
+	private:
+		std::atomic<std::uint32_t> Count = 0;
+
+		// Jobs waiting for the count to reach zero, guarded by the mutex so one can't be added as the last job finishes.
+		std::mutex ContinuationsMutex;
+		std::vector<std::pair<std::function<void()>, JobCounter*>> Continuations;
+
+	public:
+		/// @return Whether every job run against this counter has finished.
+		bool IsDone() const { return Count.load(std::memory_order_acquire) == 0; }
+	};
+
+	/// A pool of worker threads that run jobs, each with its own queue so threads rarely contend with each other. \n
+	/// A thread pushes and pops jobs at the back of its own queue, which keeps recently added work hot in its cache,
+	/// and when that's empty it steals the oldest job from the front of another thread's queue. \n
+	/// Any thread that isn't a worker shares the first queue, and only runs jobs while it's waiting.
+	class JobSystem
+	{
+	private:
+		struct Job
+		{
+			std::function<void()> Function;
+			JobCounter* Counter;
+		};
+
+		// Aligned to a cache line so threads locking neighbouring queues don't contend through false sharing.
+		struct alignas(64) Queue
+		{
+			std::mutex Mutex;
+			std::deque<Job> Jobs;
+		};
+
+		// One per thread, the first of which is shared by every thread that isn't a worker. Held by pointer as mutexes
+		// can't be moved.
+		std::vector<std::unique_ptr<Queue>> Queues;
+
+		// Only used to sleep when there's nothing to steal, rather than spin.
+		std::atomic<std::uint32_t> QueuedJobs = 0;
+		std::mutex SleepMutex;
+		std::condition_variable_any Wake;
+
+		// Declared last so the threads are joined before anything they use is destroyed.
+		std::vector<std::jthread> Workers;
+
+		std::size_t CurrentQueue() const;
+
+		void Push(std::size_t queue, Job job);
+
+		bool TryPop(std::size_t queue, Job& job);
+
+		bool TrySteal(std::size_t thief, Job& job);
+
+		bool TryRunOne(std::size_t queue);
+
+		void Execute(Job& job);
+
+		void WorkerLoop(std::stop_token stopToken, std::size_t queue);
+
+	public:
+		/* CONSTRUCTORS */
+		/// @param threadCount The number of threads to run jobs on, including the one that waits on them. One creates no
+		/// workers at all, and every job is run by the thread that waits.
+		explicit JobSystem(std::size_t threadCount = std::max(std::thread::hardware_concurrency(), 1u));
+
+		~JobSystem();
+
+		/* COPY AND MOVE OPERATIONS*/
+		JobSystem(const JobSystem& other) = delete;
+
+		JobSystem(JobSystem&& other) noexcept = delete;
+
+		JobSystem& operator=(const JobSystem& other) = delete;
+
+		JobSystem& operator=(JobSystem&& other) noexcept = delete;
+
+		/* METHODS */
+		/// The number of threads jobs are run on, including the one that waits.
+		std::size_t ThreadCount() const { return Queues.size(); }
+
+		/// Queues \p function to be run on any thread, \p counter is done once it and every other job run against it
+		/// have finished.
+		void Run(std::function<void()> function, JobCounter& counter);
+
+		/// Like Run, but \p function isn't queued until \p dependency is done.
+		void Run(std::function<void()> function, JobCounter& counter, JobCounter& dependency);
+
+		/// Runs queued jobs on this thread until \p counter is done, so waiting from inside a job can't deadlock.
+		void Wait(JobCounter& counter);
+
+		/// Calls \p function for consecutive ranges that together cover [0, \p count), in parallel, returning once all of
+		/// them have finished.
+		/// @param function Invoked as function(begin, end).
+		/// @param minimumBatchSize The fewest indices given to a single job, so the per job overhead is worth paying.
+		template <class Function>
+		void ParallelFor(std::size_t count, Function&& function, std::size_t minimumBatchSize = 1)
+		{
+			if (count == 0) { return; }
+
+			// A few batches per thread so a thread that finishes early can steal from one that's fallen behind.
+			const std::size_t targetBatches = ThreadCount() * 4;
+			const std::size_t batchSize = std::max((count + targetBatches - 1) / targetBatches, minimumBatchSize);
+
+			JobCounter counter;
+			std::size_t begin = 0;
+			for (; begin + batchSize < count; begin += batchSize)
+			{
+				Run([&function, begin, batchSize] { function(begin, begin + batchSize); }, counter);
+			}
+
+			// The caller takes the last batch itself, rather than queueing it only to pop it straight back off.
+			function(begin, count);
+			Wait(counter);
+		}
+	};
+}
@@ -4,6 +4,7 @@
 #include <limits>
 #include <numbers>
 #include <print>
+#include <type_traits>
 
 namespace Engine3
 {
@@ -25,6 +26,10 @@ namespace Engine3
 		// TODO: Use constexpr std::sqrt: P0533 https://en.cppreference.com/w/cpp/compiler_support
 		// TODO: Handle edge cases/Hope by the time there's problems the compilers are updated.
 
+		// The recursion below is only needed to keep this usable in constant expressions, at runtime it's far slower
+		// than the hardware instruction.
+		if (!std::is_constant_evaluated()) { return std::sqrt(number); }
+
 		// https://stackoverflow.com/a/34134071
 		constexpr auto newtonRaphson = [](this auto const& newtonRaphson,
 		                                  T original, T current, T previous) constexpr -> T
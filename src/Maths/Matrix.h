@@ -3,8 +3,10 @@
 #include <array>
 #include <concepts>
 #include <cstddef>
+#include <type_traits>
 #include <utility>
 #include "Maths.h"
+#include "SIMD.h"
 #include "Vector.h"
 
 namespace Engine3
@@ -33,11 +35,97 @@ namespace Engine3
 
 	namespace Detail
 	{
+		/*
+		 * 4x4 Float Kernels
+		 * Operate on row-major arrays of 16 floats. Each output row is built by broadcasting an element of the left
+		 * operand across a register and multiplying it by a whole row of the right operand, so no columns need to be
+		 * gathered. The products are accumulated in the same order as the scalar dot product, so the results are
+		 * identical to the generic path.
+		 */
+		/// \p result = \p lhs * \p rhs. \p result may alias either operand.
+		inline void Multiply4x4(const float* lhs, const float* rhs, float* result)
+		{
+			const SIMD::Float4 rhsRow0 = SIMD::Load(rhs);
+			const SIMD::Float4 rhsRow1 = SIMD::Load(rhs + 4);
+			const SIMD::Float4 rhsRow2 = SIMD::Load(rhs + 8);
+			const SIMD::Float4 rhsRow3 = SIMD::Load(rhs + 12);
+
+			SIMD::Float4 rows[4];
+			for (std::size_t row = 0; row < 4; ++row)
+			{
+				const SIMD::Float4 lhsRow = SIMD::Load(lhs + row * 4);
+				rows[row] = SIMD::Splat<0>(lhsRow) * rhsRow0
+					+ SIMD::Splat<1>(lhsRow) * rhsRow1
+					+ SIMD::Splat<2>(lhsRow) * rhsRow2
+					+ SIMD::Splat<3>(lhsRow) * rhsRow3;
+			}
+
+			for (std::size_t row = 0; row < 4; ++row) { SIMD::Store(result + row * 4, rows[row]); }
+		}
+
+		/// Row vector by matrix, \p result = \p lhs * \p rhs.
+		inline SIMD::Float4 Multiply4(SIMD::Float4 lhs, const float* rhs)
+		{
+			return SIMD::Splat<0>(lhs) * SIMD::Load(rhs)
+				+ SIMD::Splat<1>(lhs) * SIMD::Load(rhs + 4)
+				+ SIMD::Splat<2>(lhs) * SIMD::Load(rhs + 8)
+				+ SIMD::Splat<3>(lhs) * SIMD::Load(rhs + 12);
+		}
+
+		/// Matrix by column vector, \p result = \p lhs * \p rhs.
+		inline SIMD::Float4 Multiply4(const float* lhs, SIMD::Float4 rhs)
+		{
+			// Transposing turns each column into a row, at which point it's the same as the row vector case.
+			SIMD::Float4 column0 = SIMD::Load(lhs);
+			SIMD::Float4 column1 = SIMD::Load(lhs + 4);
+			SIMD::Float4 column2 = SIMD::Load(lhs + 8);
+			SIMD::Float4 column3 = SIMD::Load(lhs + 12);
+			SIMD::Transpose(column0, column1, column2, column3);
+
+			return SIMD::Splat<0>(rhs) * column0
+				+ SIMD::Splat<1>(rhs) * column1
+				+ SIMD::Splat<2>(rhs) * column2
+				+ SIMD::Splat<3>(rhs) * column3;
+		}
+
+		/// Writes the inverse of an affine matrix to \p result, given the rows of its inverted upper 3x3 portion, with
+		/// their W lanes zeroed, and \p translation, the translation row of the original matrix.
+		inline void StoreAffineInverse(SIMD::Float4 row0, SIMD::Float4 row1, SIMD::Float4 row2, const float* translation,
+		                               float* result)
+		{
+			// The translation is undone by moving it through the inverse, the W lane then only picks up the one.
+			const SIMD::Float4 t = SIMD::Load(translation);
+			const SIMD::Float4 row3 = -(SIMD::Splat<0>(t) * row0 + SIMD::Splat<1>(t) * row1 + SIMD::Splat<2>(t) * row2)
+				+ SIMD::Set(0, 0, 0, 1);
+
+			SIMD::Store(result, row0);
+			SIMD::Store(result + 4, row1);
+			SIMD::Store(result + 8, row2);
+			SIMD::Store(result + 12, row3);
+		}
+
+		/// Inverse of an affine matrix whose upper 3x3 portion is orthonormal. \p result may alias \p matrix.
+		inline void InvertOrthonormal4x4(const float* matrix, float* result)
+		{
+			// The last column is (0, 0, 0, 1), so leaving out the translation row means the transposed rows have their
+			// W lanes zeroed.
+			SIMD::Float4 row0 = SIMD::Load(matrix);
+			SIMD::Float4 row1 = SIMD::Load(matrix + 4);
+			SIMD::Float4 row2 = SIMD::Load(matrix + 8);
+			SIMD::Float4 row3 = SIMD::Broadcast(0);
+			SIMD::Transpose(row0, row1, row2, row3);
+
+			StoreAffineInverse(row0, row1, row2, matrix + 12, result);
+		}
+
 		template <std::size_t RowSize, std::size_t ColumnSize, Number T>
 		struct MatrixBase : std::array<T, RowSize * ColumnSize>
 		{
 			static constexpr std::size_t MainDiagonalSize = std::min(RowSize, ColumnSize);
 
+			/// Whether the 4x4 float kernels above can be used at runtime.
+			static constexpr bool IsVectorised = std::same_as<T, float> && RowSize == 4 && ColumnSize == 4;
+
 			/*
 			 * Static Methods
 			 */
@@ -702,6 +790,15 @@ namespace Engine3
 			                                const Matrix<ColumnSize, OtherColumnSize, T>& rhs)
 			{
 				Matrix<RowSize, OtherColumnSize, T> result;
+				if constexpr (IsVectorised && OtherColumnSize == 4)
+				{
+					if (!std::is_constant_evaluated())
+					{
+						Multiply4x4(lhs.data(), rhs.data(), result.data());
+						return result;
+					}
+				}
+
 				for (std::size_t row = 0; row < RowSize; ++row)
 				{
 					for (std::size_t column = 0; column < OtherColumnSize; ++column)
@@ -728,6 +825,16 @@ namespace Engine3
 			constexpr friend auto operator*(const Vector<RowSize, T>& lhs,
 			                                const Matrix<RowSize, ColumnSize, T>& rhs)
 			{
+				if constexpr (IsVectorised)
+				{
+					if (!std::is_constant_evaluated())
+					{
+						Vector<ColumnSize, T> rowVector;
+						SIMD::Store(rowVector.data(), Multiply4(SIMD::Load(lhs.data()), rhs.data()));
+						return rowVector;
+					}
+				}
+
 				Vector<ColumnSize, T> rowVector;
 				for (std::size_t column = 0; column < rowVector.size(); ++column)
 				{
@@ -744,6 +851,16 @@ namespace Engine3
 			constexpr friend auto operator*(const Matrix<RowSize, ColumnSize, T>& lhs,
 			                                const Vector<ColumnSize, T>& rhs)
 			{
+				if constexpr (IsVectorised)
+				{
+					if (!std::is_constant_evaluated())
+					{
+						Vector<RowSize, T> columnVector;
+						SIMD::Store(columnVector.data(), Multiply4(lhs.data(), SIMD::Load(rhs.data())));
+						return columnVector;
+					}
+				}
+
 				Vector<RowSize, T> columnVector;
 
 				for (std::size_t row = 0; row < columnVector.size(); ++row)
@@ -829,4 +946,208 @@ namespace Engine3
 			};
 		}
 	};
+
+	// Row first, then column to follow normal matrix conventions.
+	/// Matrix with its elements stored in row-major order.
+	///	Linear transformations assume row vectors.
+	/// @tparam RowSize The vertical size of the matrix.
+	/// @tparam ColumnSize The horizontal size of the matrix.
+	/// @tparam T The type of each element stored in the matrix.
+	template <Number T>
+	struct Matrix<4, 4, T> final : Detail::MatrixBase<4, 4, T>
+	{
+		/* Methods */
+		// The generic square matrix methods recurse through Cofactor -> Minor -> Submatrix, which for a 4x4 matrix means
+		// computing the same 2x2 determinants many times over. Instead, expand along the first two rows, where the twelve
+		// 2x2 determinants of the top and bottom halves are all that's needed for both the determinant and the adjoint.
+		constexpr T Determinant() const
+		{
+			const SubDeterminants d = ComputeSubDeterminants();
+			return Determinant(d);
+		}
+
+		constexpr Matrix Adjoint() const
+		{
+			const SubDeterminants d = ComputeSubDeterminants();
+			return Adjoint(d);
+		}
+
+		constexpr bool IsInvertible() const { return !(Determinant() == 0); }
+
+		/// In the case of an orthogonal matrix, prefer using the transpose as it is equivalent and simpler to compute.
+		/// For transforms prefer InvertedAffine or InvertedOrthonormal.
+		constexpr Matrix Inverted() const
+		{
+			const SubDeterminants d = ComputeSubDeterminants();
+			const T determinant = Determinant(d);
+			assert(determinant != 0);
+
+			return Adjoint(d) / determinant;
+		}
+
+		/// In the case of an orthogonal matrix, prefer using the transpose as it is equivalent and simpler to compute.
+		/// For transforms prefer InvertedAffine or InvertedOrthonormal.
+		constexpr Matrix& Invert()
+		{
+			*this = Inverted();
+			return *this;
+		}
+
+		/// Inverts a matrix made up of any linear transformation followed by a translation, where the last column is
+		/// (0, 0, 0, 1). Only the upper 3x3 portion needs a full inverse, the translation is then undone by moving
+		/// it through that inverse.
+		constexpr Matrix InvertedAffine() const requires std::floating_point<T>
+		{
+			const Matrix& m = *this;
+			assert(m(0, 3) == 0 && m(1, 3) == 0 && m(2, 3) == 0 && m(3, 3) == 1);
+
+			// Cofactors of the first row are shared between the determinant and the adjoint.
+			const T cofactor00 = m(1, 1) * m(2, 2) - m(1, 2) * m(2, 1);
+			const T cofactor01 = m(1, 2) * m(2, 0) - m(1, 0) * m(2, 2);
+			const T cofactor02 = m(1, 0) * m(2, 1) - m(1, 1) * m(2, 0);
+
+			const T determinant = m(0, 0) * cofactor00 + m(0, 1) * cofactor01 + m(0, 2) * cofactor02;
+			assert(determinant != 0);
+			const T inverseDeterminant = static_cast<T>(1) / determinant;
+
+			const T inverse00 = cofactor00 * inverseDeterminant;
+			const T inverse01 = (m(0, 2) * m(2, 1) - m(0, 1) * m(2, 2)) * inverseDeterminant;
+			const T inverse02 = (m(0, 1) * m(1, 2) - m(0, 2) * m(1, 1)) * inverseDeterminant;
+			const T inverse10 = cofactor01 * inverseDeterminant;
+			const T inverse11 = (m(0, 0) * m(2, 2) - m(0, 2) * m(2, 0)) * inverseDeterminant;
+			const T inverse12 = (m(0, 2) * m(1, 0) - m(0, 0) * m(1, 2)) * inverseDeterminant;
+			const T inverse20 = cofactor02 * inverseDeterminant;
+			const T inverse21 = (m(0, 1) * m(2, 0) - m(0, 0) * m(2, 1)) * inverseDeterminant;
+			const T inverse22 = (m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0)) * inverseDeterminant;
+
+			if constexpr (Matrix::IsVectorised)
+			{
+				if (!std::is_constant_evaluated())
+				{
+					Matrix inverse;
+					Detail::StoreAffineInverse(
+						SIMD::Set(inverse00, inverse01, inverse02, 0),
+						SIMD::Set(inverse10, inverse11, inverse12, 0),
+						SIMD::Set(inverse20, inverse21, inverse22, 0),
+						m.data() + 12, inverse.data());
+
+					return inverse;
+				}
+			}
+
+			return WithInverseTranslation(
+			{
+				inverse00, inverse01, inverse02, 0,
+				inverse10, inverse11, inverse12, 0,
+				inverse20, inverse21, inverse22, 0,
+				0, 0, 0, 1
+			});
+		}
+
+		/// Inverts a rigid transform, a rotation followed by a translation, where the upper 3x3 portion is orthonormal.
+		/// The inverse of an orthonormal matrix is its transpose, so no division is necessary.
+		constexpr Matrix InvertedOrthonormal() const
+		{
+			const Matrix& m = *this;
+			assert(m(0, 3) == 0 && m(1, 3) == 0 && m(2, 3) == 0 && m(3, 3) == 1);
+
+			if constexpr (Matrix::IsVectorised)
+			{
+				if (!std::is_constant_evaluated())
+				{
+					Matrix inverse;
+					Detail::InvertOrthonormal4x4(m.data(), inverse.data());
+
+					return inverse;
+				}
+			}
+
+			return WithInverseTranslation(
+			{
+				m(0, 0), m(1, 0), m(2, 0), 0,
+				m(0, 1), m(1, 1), m(2, 1), 0,
+				m(0, 2), m(1, 2), m(2, 2), 0,
+				0, 0, 0, 1
+			});
+		}
+
+	private:
+		/// The 2x2 determinants of the top two rows, and of the bottom two rows, named after the columns they use.
+		struct SubDeterminants
+		{
+			T Top01, Top02, Top03, Top12, Top13, Top23;
+			T Bottom01, Bottom02, Bottom03, Bottom12, Bottom13, Bottom23;
+		};
+
+		constexpr SubDeterminants ComputeSubDeterminants() const
+		{
+			const Matrix& m = *this;
+			return
+			{
+				m(0, 0) * m(1, 1) - m(1, 0) * m(0, 1),
+				m(0, 0) * m(1, 2) - m(1, 0) * m(0, 2),
+				m(0, 0) * m(1, 3) - m(1, 0) * m(0, 3),
+				m(0, 1) * m(1, 2) - m(1, 1) * m(0, 2),
+				m(0, 1) * m(1, 3) - m(1, 1) * m(0, 3),
+				m(0, 2) * m(1, 3) - m(1, 2) * m(0, 3),
+
+				m(2, 0) * m(3, 1) - m(3, 0) * m(2, 1),
+				m(2, 0) * m(3, 2) - m(3, 0) * m(2, 2),
+				m(2, 0) * m(3, 3) - m(3, 0) * m(2, 3),
+				m(2, 1) * m(3, 2) - m(3, 1) * m(2, 2),
+				m(2, 1) * m(3, 3) - m(3, 1) * m(2, 3),
+				m(2, 2) * m(3, 3) - m(3, 2) * m(2, 3)
+			};
+		}
+
+		static constexpr T Determinant(const SubDeterminants& d)
+		{
+			// Laplace expansion, pairing each top determinant with the bottom determinant of the remaining columns.
+			return d.Top01 * d.Bottom23 - d.Top02 * d.Bottom13 + d.Top03 * d.Bottom12
+				+ d.Top12 * d.Bottom03 - d.Top13 * d.Bottom02 + d.Top23 * d.Bottom01;
+		}
+
+		constexpr Matrix Adjoint(const SubDeterminants& d) const
+		{
+			const Matrix& m = *this;
+			return
+			{
+				m(1, 1) * d.Bottom23 - m(1, 2) * d.Bottom13 + m(1, 3) * d.Bottom12,
+				-m(0, 1) * d.Bottom23 + m(0, 2) * d.Bottom13 - m(0, 3) * d.Bottom12,
+				m(3, 1) * d.Top23 - m(3, 2) * d.Top13 + m(3, 3) * d.Top12,
+				-m(2, 1) * d.Top23 + m(2, 2) * d.Top13 - m(2, 3) * d.Top12,
+
+				-m(1, 0) * d.Bottom23 + m(1, 2) * d.Bottom03 - m(1, 3) * d.Bottom02,
+				m(0, 0) * d.Bottom23 - m(0, 2) * d.Bottom03 + m(0, 3) * d.Bottom02,
+				-m(3, 0) * d.Top23 + m(3, 2) * d.Top03 - m(3, 3) * d.Top02,
+				m(2, 0) * d.Top23 - m(2, 2) * d.Top03 + m(2, 3) * d.Top02,
+
+				m(1, 0) * d.Bottom13 - m(1, 1) * d.Bottom03 + m(1, 3) * d.Bottom01,
+				-m(0, 0) * d.Bottom13 + m(0, 1) * d.Bottom03 - m(0, 3) * d.Bottom01,
+				m(3, 0) * d.Top13 - m(3, 1) * d.Top03 + m(3, 3) * d.Top01,
+				-m(2, 0) * d.Top13 + m(2, 1) * d.Top03 - m(2, 3) * d.Top01,
+
+				-m(1, 0) * d.Bottom12 + m(1, 1) * d.Bottom02 - m(1, 2) * d.Bottom01,
+				m(0, 0) * d.Bottom12 - m(0, 1) * d.Bottom02 + m(0, 2) * d.Bottom01,
+				-m(3, 0) * d.Top12 + m(3, 1) * d.Top02 - m(3, 2) * d.Top01,
+				m(2, 0) * d.Top12 - m(2, 1) * d.Top02 + m(2, 2) * d.Top01
+			};
+		}
+
+		/// Given the inverse of the upper 3x3 portion, fills in the translation that undoes this matrix's translation.
+		constexpr Matrix WithInverseTranslation(Matrix inverse) const
+		{
+			const Matrix& m = *this;
+
+			// Row vectors are translated after the linear transformation, so to undo it the translation must also be
+			// passed through the inverse.
+			for (std::size_t column = 0; column < 3; ++column)
+			{
+				inverse(3, column) = -(m(3, 0) * inverse(0, column) + m(3, 1) * inverse(1, column) +
+					m(3, 2) * inverse(2, column));
+			}
+
+			return inverse;
+		}
+	};
 }
@@ -1,11 +1,18 @@
 #pragma once
 #include "Maths.h"
+#include "Matrix.h"
+#include "SIMD.h"
+#include "Transform.h"
+#include "Vector.h"
+#include <array>
 #include <cassert>
+#include <cstddef>
 #include <numbers>
+#include <span>
 
 namespace Engine3
 {
-	// Probably could use the Vector struct to reduce code repetition, but I don't want to create a dependency if I can help it.
+	// Kept as separate components rather than a Vector, but Vector and Matrix are needed to rotate and convert.
 	template <std::floating_point T>
 	struct Quaternion
 	{
@@ -33,12 +40,58 @@ namespace Engine3
 		/// The larger the absolute value of the quaternion dot product, the smaller the angular displacement between
 		/// \p lhs and \p rhs.
 		/// @return For unit quaternions, a scalar value in the inclusive range [-1, 1].
-		static constexpr float DotProduct(const Quaternion& lhs, const Quaternion& rhs)
+		static constexpr T DotProduct(const Quaternion& lhs, const Quaternion& rhs)
 		{
 			auto [x1, y1, z1, w1] = lhs;
 			auto [x2, y2, z2, w2] = rhs;
 
-			return x1 * x2 + y1 * y2 + z1 * z2 + w1 * w1;
+			return x1 * x2 + y1 * y2 + z1 * z2 + w1 * w2;
+		}
+
+		/// @param axis A unit vector.
+		/// @param radians The rotation about \p axis, in the same direction as the Matrix RotationAbout methods.
+		/// @return The rotation quaternion equivalent to the axis-angle.
+		static constexpr Quaternion FromAxisAngle(const Vector<3, T>& axis, T radians)
+		{
+			assert(axis.IsUnit());
+
+			const T halfAngle = radians / 2;
+			const T sine = std::sin(halfAngle);
+			return {axis.X() * sine, axis.Y() * sine, axis.Z() * sine, std::cos(halfAngle)};
+		}
+
+		/// Extracts the rotation from a matrix, the inverse of ToMatrix.
+		/// @param matrix A rotation matrix, for 4x4 matrices any translation is ignored.
+		/// @return A unit rotation quaternion.
+		template <std::size_t Size>
+			requires (Size == 3 || Size == 4)
+		static constexpr Quaternion FromMatrix(const Matrix<Size, Size, T>& matrix)
+		{
+			const auto& m = matrix;
+			const T trace = m(0, 0) + m(1, 1) + m(2, 2);
+
+			// Each branch divides by the largest of the four components, computed from the diagonal, so the division
+			// is never close to zero.
+			if (trace > 0)
+			{
+				const T scale = SquareRoot(trace + 1) * 2;
+				return {(m(1, 2) - m(2, 1)) / scale, (m(2, 0) - m(0, 2)) / scale, (m(0, 1) - m(1, 0)) / scale, scale / 4};
+			}
+
+			if (m(0, 0) > m(1, 1) && m(0, 0) > m(2, 2))
+			{
+				const T scale = SquareRoot(1 + m(0, 0) - m(1, 1) - m(2, 2)) * 2;
+				return {scale / 4, (m(0, 1) + m(1, 0)) / scale, (m(2, 0) + m(0, 2)) / scale, (m(1, 2) - m(2, 1)) / scale};
+			}
+
+			if (m(1, 1) > m(2, 2))
+			{
+				const T scale = SquareRoot(1 + m(1, 1) - m(0, 0) - m(2, 2)) * 2;
+				return {(m(0, 1) + m(1, 0)) / scale, scale / 4, (m(1, 2) + m(2, 1)) / scale, (m(2, 0) - m(0, 2)) / scale};
+			}
+
+			const T scale = SquareRoot(1 + m(2, 2) - m(0, 0) - m(1, 1)) * 2;
+			return {(m(2, 0) + m(0, 2)) / scale, (m(1, 2) + m(2, 1)) / scale, scale / 4, (m(0, 1) - m(1, 0)) / scale};
 		}
 
 		/* INSTANCE */
@@ -93,7 +146,7 @@ namespace Engine3
 			// Prevent divide by zero when identity quaternion.
 			// The negative identity quaternion results in the same value
 			// as the identity quaternion, hence absolute value.
-			if (AlmostLessThan(std::abs(w), 1))
+			if (AlmostLessThan<T>(std::abs(w), 1))
 			{
 				// The w component of a quaternion is equal to cos(theta/2).
 				T halfAngle = std::acos(w);
@@ -116,6 +169,54 @@ namespace Engine3
 			return result;
 		}
 
+		/// Rotates \p vector directly, without forming the full q * v * q^-1 product. \n
+		/// This function assumes a unit quaternion. When rotating many vectors by the same quaternion, convert it with
+		/// ToMatrix once instead.
+		constexpr Vector<3, T> Rotate(const Vector<3, T>& vector) const
+		{
+			assert(IsUnit());
+
+			// v' = v + w * t + u x t, where u is the vector portion and t = 2(u x v).
+			const auto [vx, vy, vz] = vector;
+			const T tx = 2 * (Y * vz - Z * vy);
+			const T ty = 2 * (Z * vx - X * vz);
+			const T tz = 2 * (X * vy - Y * vx);
+
+			return
+			{
+				vx + W * tx + (Y * tz - Z * ty),
+				vy + W * ty + (Z * tx - X * tz),
+				vz + W * tz + (X * ty - Y * tx)
+			};
+		}
+
+		/// This function assumes a unit quaternion.
+		/// @tparam Size 3 for a linear transformation, or 4 for one that can be combined with translations.
+		/// @return The rotation matrix for row vectors, equivalent to the RotationAbout methods.
+		template <std::size_t Size = 3>
+			requires (Size == 3 || Size == 4)
+		constexpr Matrix<Size, Size, T> ToMatrix() const
+		{
+			assert(IsUnit());
+
+			const T xx = X * X, yy = Y * Y, zz = Z * Z;
+			const T xy = X * Y, xz = X * Z, yz = Y * Z;
+			const T wx = W * X, wy = W * Y, wz = W * Z;
+
+			Matrix<Size, Size, T> matrix = Matrix<Size, Size, T>::Identity();
+			matrix(0, 0) = 1 - 2 * (yy + zz);
+			matrix(0, 1) = 2 * (xy + wz);
+			matrix(0, 2) = 2 * (xz - wy);
+			matrix(1, 0) = 2 * (xy - wz);
+			matrix(1, 1) = 1 - 2 * (xx + zz);
+			matrix(1, 2) = 2 * (yz + wx);
+			matrix(2, 0) = 2 * (xz + wy);
+			matrix(2, 1) = 2 * (yz - wx);
+			matrix(2, 2) = 1 - 2 * (xx + yy);
+
+			return matrix;
+		}
+
 		constexpr bool IsUnit() const
 		{
 			// It is not necessary to check Length(), because if it is a unit vector then LengthSquared() is the same value.
@@ -178,13 +279,13 @@ namespace Engine3
 			x1 = -x1;
 			y1 = -y1;
 			z1 = -z1;
-			w1 = -z1;
+			w1 = -w1;
 			cosineOfTheAngle = -cosineOfTheAngle;
 		}
 
 		// If divide by zero, linearly interpolate to avoid NaN/infinity.
 		T k0, k1;
-		if (AlmostGreaterThan(cosineOfTheAngle, 1))
+		if (AlmostGreaterThan<T>(cosineOfTheAngle, 1))
 		{
 			k0 = 1.0f - fraction;
 			k1 = fraction;
@@ -197,10 +298,10 @@ namespace Engine3
 			T angle = std::atan2(sinOfTheAngle, cosineOfTheAngle);
 
 			// Cache so only a single division is necessary.
-			float inverseAngle = 1 / angle;
+			T inverseSine = 1 / sinOfTheAngle;
 
-			k0 = std::sin((1.0f - fraction) * angle) * inverseAngle;
-			k1 = std::sin(fraction * angle) * inverseAngle;
+			k0 = std::sin((1 - fraction) * angle) * inverseSine;
+			k1 = std::sin(fraction * angle) * inverseSine;
 		}
 
 		// Interpolate
@@ -213,8 +314,279 @@ namespace Engine3
 		};
 
 		// This shouldn't occur, but just in case.
-		auto [x, y, z, w] = result;
 		assert(result.IsUnit());
 		return result;
 	}
+
+	/// Linearly interpolates along the shorter arc and normalises the result. \n
+	/// Unlike spherical linear interpolation the angular velocity isn't constant, it's fastest halfway, but the
+	/// path is the same and it's far cheaper, so it's suited to blending between nearby orientations.
+	template <typename T, typename U>
+	constexpr Quaternion<T> NormalisedLinearInterpolation(const Quaternion<T>& start, const Quaternion<T>& end,
+	                                                      U fraction)
+	{
+		auto& [x0, y0, z0, w0] = start;
+		auto [x1, y1, z1, w1] = Quaternion<T>::DotProduct(start, end) < 0 ? -end : end;
+
+		Quaternion<T> result
+		{
+			x0 + fraction * (x1 - x0),
+			y0 + fraction * (y1 - y0),
+			z0 + fraction * (z1 - z0),
+			w0 + fraction * (w1 - w0)
+		};
+
+		// Only zero if interpolating halfway between opposite quaternions, which the sign flip prevents.
+		const T inverseLength = 1 / result.Length();
+		return {result.X * inverseLength, result.Y * inverseLength, result.Z * inverseLength, result.W * inverseLength};
+	}
+
+	namespace Detail
+	{
+		/*
+		 * Spherical Linear Interpolation Approximation
+		 * David Eberly, "A Fast and Accurate Algorithm for Computing SLERP".
+		 * sin(t * angle) / sin(angle) is a polynomial in t and cos(angle) - 1, truncated here to eight terms with
+		 * the last scaled by Mu to balance the truncation error across the range.
+		 */
+		inline constexpr std::size_t SlerpTerms = 8;
+		inline constexpr double SlerpMu = 1.85298109240830;
+
+		// Stored in the interpolated type so there's no conversion in the loop.
+		template <std::floating_point T>
+		inline constexpr std::array<T, SlerpTerms> SlerpU = []
+		{
+			std::array<T, SlerpTerms> u;
+			for (std::size_t i = 1; i <= SlerpTerms; ++i)
+			{
+				double value = 1. / static_cast<double>(i * (2 * i + 1));
+				if (i == SlerpTerms) { value *= SlerpMu; }
+				u[i - 1] = static_cast<T>(value);
+			}
+
+			return u;
+		}();
+
+		template <std::floating_point T>
+		inline constexpr std::array<T, SlerpTerms> SlerpV = []
+		{
+			std::array<T, SlerpTerms> v;
+			for (std::size_t i = 1; i <= SlerpTerms; ++i)
+			{
+				double value = static_cast<double>(i) / static_cast<double>(2 * i + 1);
+				if (i == SlerpTerms) { value *= SlerpMu; }
+				v[i - 1] = static_cast<T>(value);
+			}
+
+			return v;
+		}();
+	}
+
+	/// Spherical linear interpolation using a polynomial approximation, so there are no trigonometric functions,
+	/// square roots or divisions. \n
+	/// Each weight is within 2e-5 of the exact value for any pair of unit quaternions and \p fraction in [0, 1], so
+	/// the result is within about 4e-5 per component and not renormalised.
+	template <typename T, typename U>
+	constexpr Quaternion<T> ApproximateSphericalLinearInterpolation(const Quaternion<T>& start,
+	                                                                const Quaternion<T>& end, U fraction)
+	{
+		auto& [x0, y0, z0, w0] = start;
+		auto& [x1, y1, z1, w1] = end;
+
+		// Taking the shorter arc keeps the cosine in the range the polynomial is fitted to.
+		// Written as selects rather than a branch, as the sign is unpredictable when blending many rotations.
+		const T cosineOfTheAngle = Quaternion<T>::DotProduct(start, end);
+		const T endSign = cosineOfTheAngle < 0 ? -1 : 1;
+		const T cosineMinusOne = Abs(cosineOfTheAngle) - 1;
+
+		const T startFraction = 1 - fraction;
+		const T endFraction = fraction;
+		const T startFractionSquared = startFraction * startFraction;
+		const T endFractionSquared = endFraction * endFraction;
+
+		// Approximately sin(fraction * angle) / sin(angle), by Horner's method, innermost term first.
+		// Both weights are computed in the same loop so their dependency chains overlap.
+		T k0 = 1;
+		T k1 = 1;
+		for (std::size_t i = Detail::SlerpTerms; i-- > 0;)
+		{
+			const T u = Detail::SlerpU<T>[i];
+			const T v = Detail::SlerpV<T>[i];
+			k0 = 1 + (u * startFractionSquared - v) * cosineMinusOne * k0;
+			k1 = 1 + (u * endFractionSquared - v) * cosineMinusOne * k1;
+		}
+
+		k0 *= startFraction;
+		k1 *= endFraction * endSign;
+
+		return
+		{
+			x0 * k0 + x1 * k1,
+			y0 * k0 + y1 * k1,
+			z0 * k0 + z1 * k1,
+			w0 * k0 + w1 * k1
+		};
+	}
+
+	/*
+	 * Batch Operations
+	 * Four quaternions are transposed into one register per component, so every lane does useful work.
+	 * The output spans must be the same size as the inputs.
+	 */
+	namespace Detail
+	{
+		// So a span of quaternions can be loaded four floats at a time.
+		static_assert(sizeof(Quaternion<float>) == 4 * sizeof(float));
+
+		/// Loads four consecutive quaternions and transposes them, so \p x holds the X component of each and so on.
+		inline void LoadQuaternions(const Quaternion<float>* quaternions, SIMD::Float4& x, SIMD::Float4& y,
+		                            SIMD::Float4& z, SIMD::Float4& w)
+		{
+			x = SIMD::Load(&quaternions[0].X);
+			y = SIMD::Load(&quaternions[1].X);
+			z = SIMD::Load(&quaternions[2].X);
+			w = SIMD::Load(&quaternions[3].X);
+			SIMD::Transpose(x, y, z, w);
+		}
+	}
+
+	/// Rotates every vector in \p vectors by the same unit quaternion. \n
+	/// Converting to a matrix once costs less than the quaternion product per vector.
+	/// @param threadCount See TransformPoints.
+	inline void Rotate(const Quaternion<float>& rotation, std::span<const Vector<3>> vectors,
+	                   std::span<Vector<3>> result, std::size_t threadCount = 1)
+	{
+		TransformDirections(vectors, result, rotation.ToMatrix<4>(), threadCount);
+	}
+
+	/// Rotates each vector by the unit quaternion at the same index.
+	inline void Rotate(std::span<const Quaternion<float>> rotations, std::span<const Vector<3>> vectors,
+	                   std::span<Vector<3>> result)
+	{
+		assert(rotations.size() == vectors.size() && result.size() == vectors.size());
+
+		std::size_t i = 0;
+		for (; i + 4 <= vectors.size(); i += 4)
+		{
+			SIMD::Float4 x, y, z, w;
+			Detail::LoadQuaternions(&rotations[i], x, y, z, w);
+
+			SIMD::Float4 vx, vy, vz;
+			SIMD::Deinterleave3(vectors[i].data(), vx, vy, vz);
+
+			// Same as Quaternion::Rotate, one lane per quaternion.
+			const SIMD::Float4 two = SIMD::Broadcast(2);
+			const SIMD::Float4 tx = two * (y * vz - z * vy);
+			const SIMD::Float4 ty = two * (z * vx - x * vz);
+			const SIMD::Float4 tz = two * (x * vy - y * vx);
+
+			SIMD::Interleave3(result[i].data(),
+			                  vx + w * tx + (y * tz - z * ty),
+			                  vy + w * ty + (z * tx - x * tz),
+			                  vz + w * tz + (x * ty - y * tx));
+		}
+
+		for (; i < vectors.size(); ++i) { result[i] = rotations[i].Rotate(vectors[i]); }
+	}
+
+	/// Converts each unit quaternion to its rotation matrix, see Quaternion::ToMatrix.
+	inline void ToMatrices(std::span<const Quaternion<float>> rotations, std::span<Matrix<4>> result)
+	{
+		assert(rotations.size() == result.size());
+
+		std::size_t i = 0;
+		for (; i + 4 <= rotations.size(); i += 4)
+		{
+			SIMD::Float4 x, y, z, w;
+			Detail::LoadQuaternions(&rotations[i], x, y, z, w);
+
+			const SIMD::Float4 one = SIMD::Broadcast(1);
+			const SIMD::Float4 two = SIMD::Broadcast(2);
+			const SIMD::Float4 xx = x * x, yy = y * y, zz = z * z;
+			const SIMD::Float4 xy = x * y, xz = x * z, yz = y * z;
+			const SIMD::Float4 wx = w * x, wy = w * y, wz = w * z;
+
+			// Each register holds one element from four matrices, transposing turns them into a row from each.
+			SIMD::Float4 rows[3][4] =
+			{
+				{one - two * (yy + zz), two * (xy + wz), two * (xz - wy), SIMD::Broadcast(0)},
+				{two * (xy - wz), one - two * (xx + zz), two * (yz + wx), SIMD::Broadcast(0)},
+				{two * (xz + wy), two * (yz - wx), one - two * (xx + yy), SIMD::Broadcast(0)}
+			};
+
+			for (std::size_t row = 0; row < 3; ++row)
+			{
+				SIMD::Transpose(rows[row][0], rows[row][1], rows[row][2], rows[row][3]);
+				for (std::size_t matrix = 0; matrix < 4; ++matrix)
+				{
+					SIMD::Store(&result[i + matrix](row, 0), rows[row][matrix]);
+				}
+			}
+
+			const SIMD::Float4 translation = SIMD::Set(0, 0, 0, 1);
+			for (std::size_t matrix = 0; matrix < 4; ++matrix) { SIMD::Store(&result[i + matrix](3, 0), translation); }
+		}
+
+		for (; i < rotations.size(); ++i) { result[i] = rotations[i].ToMatrix<4>(); }
+	}
+
+	/// Interpolates each pair of quaternions by the fraction at the same index, four at a time, using the same
+	/// approximation as ApproximateSphericalLinearInterpolation.
+	inline void ApproximateSphericalLinearInterpolation(std::span<const Quaternion<float>> starts,
+	                                                    std::span<const Quaternion<float>> ends,
+	                                                    std::span<const float> fractions,
+	                                                    std::span<Quaternion<float>> result)
+	{
+		assert(starts.size() == ends.size() && fractions.size() == starts.size() && result.size() == starts.size());
+
+		std::size_t i = 0;
+		for (; i + 4 <= starts.size(); i += 4)
+		{
+			SIMD::Float4 x0, y0, z0, w0;
+			SIMD::Float4 x1, y1, z1, w1;
+			Detail::LoadQuaternions(&starts[i], x0, y0, z0, w0);
+			Detail::LoadQuaternions(&ends[i], x1, y1, z1, w1);
+
+			// Flipping the end's weight rather than the end itself is the same as the scalar version's sign.
+			const SIMD::Float4 dotProduct = x0 * x1 + y0 * y1 + z0 * z1 + w0 * w1;
+			const SIMD::Float4 cosineMinusOne = SIMD::FlipSign(dotProduct, dotProduct) - SIMD::Broadcast(1);
+
+			const SIMD::Float4 one = SIMD::Broadcast(1);
+			const SIMD::Float4 fraction = SIMD::Load(&fractions[i]);
+			const SIMD::Float4 startFraction = one - fraction;
+			const SIMD::Float4 fractionSquared = fraction * fraction;
+			const SIMD::Float4 startFractionSquared = startFraction * startFraction;
+
+			SIMD::Float4 k0 = one;
+			SIMD::Float4 k1 = one;
+			for (std::size_t term = Detail::SlerpTerms; term-- > 0;)
+			{
+				const SIMD::Float4 u = SIMD::Broadcast(Detail::SlerpU<float>[term]);
+				const SIMD::Float4 v = SIMD::Broadcast(Detail::SlerpV<float>[term]);
+				const SIMD::Float4 startTerm = u * startFractionSquared - v;
+				const SIMD::Float4 endTerm = u * fractionSquared - v;
+				k0 = one + startTerm * cosineMinusOne * k0;
+				k1 = one + endTerm * cosineMinusOne * k1;
+			}
+
+			k0 = startFraction * k0;
+			k1 = SIMD::FlipSign(fraction * k1, dotProduct);
+
+			SIMD::Float4 x = x0 * k0 + x1 * k1;
+			SIMD::Float4 y = y0 * k0 + y1 * k1;
+			SIMD::Float4 z = z0 * k0 + z1 * k1;
+			SIMD::Float4 w = w0 * k0 + w1 * k1;
+			SIMD::Transpose(x, y, z, w);
+
+			SIMD::Store(&result[i].X, x);
+			SIMD::Store(&result[i + 1].X, y);
+			SIMD::Store(&result[i + 2].X, z);
+			SIMD::Store(&result[i + 3].X, w);
+		}
+
+		for (; i < starts.size(); ++i)
+		{
+			result[i] = ApproximateSphericalLinearInterpolation(starts[i], ends[i], fractions[i]);
+		}
+	}
 }
@@ -0,0 +1,283 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <utility>
+
+// SSE2 is part of the x86-64 baseline, so it's the only instruction set that's assumed. AVX builds will still benefit
+// as the compiler emits VEX encoded versions of the same intrinsics.
+#if !defined(ENGINE3_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define ENGINE3_SIMD_SSE 1
+#include <immintrin.h>
+#else
+#define ENGINE3_SIMD_SSE 0
+#endif
+
+namespace Engine3::SIMD
+{
+	/// Four packed single precision floats. \n
+	/// This maps onto an SSE register where available, otherwise it falls back to plain scalar code so that anything
+	/// written against it still works on other architectures.
+	///
+	/// None of these functions are constexpr, callers should guard their use with std::is_constant_evaluated().
+	struct Float4
+	{
+#if ENGINE3_SIMD_SSE
+		__m128 Value;
+#else
+		float Value[4];
+#endif
+	};
+
+	/* Loads and Stores */
+	/// @param values Four contiguous floats, no alignment is required.
+	inline Float4 Load(const float* values)
+	{
+#if ENGINE3_SIMD_SSE
+		return {_mm_loadu_ps(values)};
+#else
+		return {values[0], values[1], values[2], values[3]};
+#endif
+	}
+
+	/// Loads three contiguous floats, zeroing the fourth lane. \n
+	/// This never reads past the third float, so it is safe to use on the last element of an array of Vector<3>.
+	inline Float4 Load3(const float* values)
+	{
+#if ENGINE3_SIMD_SSE
+		const __m128 xy = _mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(values)));
+		const __m128 z = _mm_load_ss(values + 2);
+		return {_mm_movelh_ps(xy, z)};
+#else
+		return {values[0], values[1], values[2], 0};
+#endif
+	}
+
+	/// @param values Destination for four contiguous floats, no alignment is required.
+	inline void Store(float* values, Float4 vector)
+	{
+#if ENGINE3_SIMD_SSE
+		_mm_storeu_ps(values, vector.Value);
+#else
+		for (std::size_t i = 0; i < 4; ++i) { values[i] = vector.Value[i]; }
+#endif
+	}
+
+	/// Stores the first three lanes, never writing past the third float.
+	inline void Store3(float* values, Float4 vector)
+	{
+#if ENGINE3_SIMD_SSE
+		_mm_storel_pi(reinterpret_cast<__m64*>(values), vector.Value);
+		_mm_store_ss(values + 2, _mm_movehl_ps(vector.Value, vector.Value));
+#else
+		for (std::size_t i = 0; i < 3; ++i) { values[i] = vector.Value[i]; }
+#endif
+	}
+
+	/// @return A register with \p value copied into every lane.
+	inline Float4 Broadcast(float value)
+	{
+#if ENGINE3_SIMD_SSE
+		return {_mm_set1_ps(value)};
+#else
+		return {value, value, value, value};
+#endif
+	}
+
+	/// @return A register with \p x in the lowest lane and \p w in the highest.
+	inline Float4 Set(float x, float y, float z, float w)
+	{
+#if ENGINE3_SIMD_SSE
+		return {_mm_setr_ps(x, y, z, w)};
+#else
+		return {x, y, z, w};
+#endif
+	}
+
+	/// @return A register with the lane at \p Index copied into every lane.
+	template <int Index>
+		requires (Index >= 0 && Index < 4)
+	Float4 Splat(Float4 vector)
+	{
+#if ENGINE3_SIMD_SSE
+		return {_mm_shuffle_ps(vector.Value, vector.Value, _MM_SHUFFLE(Index, Index, Index, Index))};
+#else
+		return Broadcast(vector.Value[Index]);
+#endif
+	}
+
+	/// @return The lowest lane of \p vector.
+	inline float First(Float4 vector)
+	{
+#if ENGINE3_SIMD_SSE
+		return _mm_cvtss_f32(vector.Value);
+#else
+		return vector.Value[0];
+#endif
+	}
+
+	/* Arithmetic */
+	inline Float4 operator+(Float4 lhs, Float4 rhs)
+	{
+#if ENGINE3_SIMD_SSE
+		return {_mm_add_ps(lhs.Value, rhs.Value)};
+#else
+		Float4 result;
+		for (std::size_t i = 0; i < 4; ++i) { result.Value[i] = lhs.Value[i] + rhs.Value[i]; }
+		return result;
+#endif
+	}
+
+	inline Float4 operator-(Float4 lhs, Float4 rhs)
+	{
+#if ENGINE3_SIMD_SSE
+		return {_mm_sub_ps(lhs.Value, rhs.Value)};
+#else
+		Float4 result;
+		for (std::size_t i = 0; i < 4; ++i) { result.Value[i] = lhs.Value[i] - rhs.Value[i]; }
+		return result;
+#endif
+	}
+
+	inline Float4 operator*(Float4 lhs, Float4 rhs)
+	{
+#if ENGINE3_SIMD_SSE
+		return {_mm_mul_ps(lhs.Value, rhs.Value)};
+#else
+		Float4 result;
+		for (std::size_t i = 0; i < 4; ++i) { result.Value[i] = lhs.Value[i] * rhs.Value[i]; }
+		return result;
+#endif
+	}
+
+	inline Float4 operator/(Float4 lhs, Float4 rhs)
+	{
+#if ENGINE3_SIMD_SSE
+		return {_mm_div_ps(lhs.Value, rhs.Value)};
+#else
+		Float4 result;
+		for (std::size_t i = 0; i < 4; ++i) { result.Value[i] = lhs.Value[i] / rhs.Value[i]; }
+		return result;
+#endif
+	}
+
+	/// Flips the sign bit of each lane, so zero becomes negative zero just like scalar negation.
+	inline Float4 operator-(Float4 vector)
+	{
+#if ENGINE3_SIMD_SSE
+		return {_mm_xor_ps(vector.Value, _mm_set1_ps(-0.f))};
+#else
+		Float4 result;
+		for (std::size_t i = 0; i < 4; ++i) { result.Value[i] = -vector.Value[i]; }
+		return result;
+#endif
+	}
+
+	/// Negates each lane of \p vector where the same lane of \p sign is negative, including negative zero.
+	inline Float4 FlipSign(Float4 vector, Float4 sign)
+	{
+#if ENGINE3_SIMD_SSE
+		return {_mm_xor_ps(vector.Value, _mm_and_ps(sign.Value, _mm_set1_ps(-0.f)))};
+#else
+		Float4 result;
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			result.Value[i] = std::signbit(sign.Value[i]) ? -vector.Value[i] : vector.Value[i];
+		}
+		return result;
+#endif
+	}
+
+	inline Float4 SquareRoot(Float4 vector)
+	{
+#if ENGINE3_SIMD_SSE
+		return {_mm_sqrt_ps(vector.Value)};
+#else
+		Float4 result;
+		for (std::size_t i = 0; i < 4; ++i) { result.Value[i] = std::sqrt(vector.Value[i]); }
+		return result;
+#endif
+	}
+
+	/* Shuffles */
+	/// Transposes the 4x4 matrix formed by treating each register as a row, in place.
+	inline void Transpose(Float4& row0, Float4& row1, Float4& row2, Float4& row3)
+	{
+#if ENGINE3_SIMD_SSE
+		_MM_TRANSPOSE4_PS(row0.Value, row1.Value, row2.Value, row3.Value);
+#else
+		Float4* rows[] = {&row0, &row1, &row2, &row3};
+		for (std::size_t row = 0; row < 4; ++row)
+		{
+			for (std::size_t column = row + 1; column < 4; ++column)
+			{
+				std::swap(rows[row]->Value[column], rows[column]->Value[row]);
+			}
+		}
+#endif
+	}
+
+	/// Loads four contiguous three component vectors, twelve floats, and splits them into one register per component.
+	/// This never reads past the twelfth float.
+	inline void Deinterleave3(const float* values, Float4& x, Float4& y, Float4& z)
+	{
+#if ENGINE3_SIMD_SSE
+		// x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+		const __m128 a = _mm_loadu_ps(values);
+		const __m128 b = _mm_loadu_ps(values + 4);
+		const __m128 c = _mm_loadu_ps(values + 8);
+
+		const __m128 x2y2x3y3 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));
+		const __m128 y0z0y1z1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));
+		x.Value = _mm_shuffle_ps(a, x2y2x3y3, _MM_SHUFFLE(2, 0, 3, 0));
+		y.Value = _mm_shuffle_ps(y0z0y1z1, x2y2x3y3, _MM_SHUFFLE(3, 1, 2, 0));
+		z.Value = _mm_shuffle_ps(y0z0y1z1, c, _MM_SHUFFLE(3, 0, 3, 1));
+#else
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			x.Value[i] = values[i * 3];
+			y.Value[i] = values[i * 3 + 1];
+			z.Value[i] = values[i * 3 + 2];
+		}
+#endif
+	}
+
+	/// The reverse of Deinterleave3, stores four three component vectors as twelve contiguous floats.
+	inline void Interleave3(float* values, Float4 x, Float4 y, Float4 z)
+	{
+#if ENGINE3_SIMD_SSE
+		const __m128 x0x2y0y2 = _mm_shuffle_ps(x.Value, y.Value, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m128 y1y3z1z3 = _mm_shuffle_ps(y.Value, z.Value, _MM_SHUFFLE(3, 1, 3, 1));
+		const __m128 z0z2x1x3 = _mm_shuffle_ps(z.Value, x.Value, _MM_SHUFFLE(3, 1, 2, 0));
+
+		_mm_storeu_ps(values, _mm_shuffle_ps(x0x2y0y2, z0z2x1x3, _MM_SHUFFLE(2, 0, 2, 0)));
+		_mm_storeu_ps(values + 4, _mm_shuffle_ps(y1y3z1z3, x0x2y0y2, _MM_SHUFFLE(3, 1, 2, 0)));
+		_mm_storeu_ps(values + 8, _mm_shuffle_ps(z0z2x1x3, y1y3z1z3, _MM_SHUFFLE(3, 1, 3, 1)));
+#else
+		for (std::size_t i = 0; i < 4; ++i)
+		{
+			values[i * 3] = x.Value[i];
+			values[i * 3 + 1] = y.Value[i];
+			values[i * 3 + 2] = z.Value[i];
+		}
+#endif
+	}
+
+	/* Horizontal Operations */
+	/// @return The sum of all four lanes, computed as (x + y) + (z + w).
+	inline float Sum(Float4 vector)
+	{
+#if ENGINE3_SIMD_SSE
+		__m128 shuffled = _mm_shuffle_ps(vector.Value, vector.Value, _MM_SHUFFLE(2, 3, 0, 1));
+		__m128 sums = _mm_add_ps(vector.Value, shuffled);
+		shuffled = _mm_movehl_ps(shuffled, sums);
+		sums = _mm_add_ss(sums, shuffled);
+		return _mm_cvtss_f32(sums);
+#else
+		return (vector.Value[0] + vector.Value[1]) + (vector.Value[2] + vector.Value[3]);
+#endif
+	}
+
+	/// Four lane dot product. For three lane vectors, ensure the fourth lane of either operand is zero, which
+	/// Load3 guarantees.
+	inline float DotProduct(Float4 lhs, Float4 rhs) { return Sum(lhs * rhs); }
+}
@@ -0,0 +1,173 @@
+#pragma once
+#include "Matrix.h"
+#include "SIMD.h"
+#include "Vector.h"
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace Engine3
+{
+	namespace Detail
+	{
+		/// How the implicit fourth component of each vector is treated when transformed.
+		enum class TransformKind
+		{
+			Point,			// W = 1, so translation applies.
+			Direction,		// W = 0, so translation is ignored.
+			Projective		// W = 1, and the result is divided by the transformed W.
+		};
+
+		/// Spawning a thread costs tens of microseconds, so below this many vectors per thread it isn't worthwhile.
+		inline constexpr std::size_t MinimumVectorsPerThread = 16384;
+
+		/// The scalar version of the kernel, for the remainder that doesn't fill a register. The products are summed in
+		/// the same order as the vectorised path, so every element gets the same result regardless of where it falls.
+		template <TransformKind Kind>
+		Vector<3> TransformOne(const Vector<3>& vector, const Matrix<4>& m)
+		{
+			Vector<3> result;
+			for (std::size_t column = 0; column < 3; ++column)
+			{
+				result[column] = vector.X() * m(0, column) + vector.Y() * m(1, column) + vector.Z() * m(2, column);
+				if constexpr (Kind != TransformKind::Direction) { result[column] += m(3, column); }
+			}
+
+			if constexpr (Kind == TransformKind::Projective)
+			{
+				const float w = vector.X() * m(0, 3) + vector.Y() * m(1, 3) + vector.Z() * m(2, 3) + m(3, 3);
+				result /= w;
+			}
+
+			return result;
+		}
+
+		/// Transforms four vectors at a time. Each group is split into one register per component, so every lane does
+		/// useful work and the matrix elements are broadcast once for the whole span.
+		template <TransformKind Kind>
+		void TransformRange(const Vector<3>* input, Vector<3>* output, std::size_t count, const Matrix<4>& m)
+		{
+			SIMD::Float4 elements[4][4];
+			for (std::size_t row = 0; row < 4; ++row)
+			{
+				for (std::size_t column = 0; column < 4; ++column)
+				{
+					elements[row][column] = SIMD::Broadcast(m(row, column));
+				}
+			}
+
+			const std::size_t vectorisedCount = count - count % 4;
+			for (std::size_t i = 0; i < vectorisedCount; i += 4)
+			{
+				// Vector<3> is exactly three floats, so four of them are twelve contiguous floats.
+				SIMD::Float4 x, y, z;
+				SIMD::Deinterleave3(input[i].data(), x, y, z);
+
+				SIMD::Float4 transformed[3];
+				for (std::size_t column = 0; column < 3; ++column)
+				{
+					transformed[column] = x * elements[0][column] + y * elements[1][column] + z * elements[2][column];
+					if constexpr (Kind != TransformKind::Direction)
+					{
+						transformed[column] = transformed[column] + elements[3][column];
+					}
+				}
+
+				if constexpr (Kind == TransformKind::Projective)
+				{
+					const SIMD::Float4 w = x * elements[0][3] + y * elements[1][3] + z * elements[2][3] + elements[3][3];
+					for (SIMD::Float4& component : transformed) { component = component / w; }
+				}
+
+				SIMD::Interleave3(output[i].data(), transformed[0], transformed[1], transformed[2]);
+			}
+
+			for (std::size_t i = vectorisedCount; i < count; ++i) { output[i] = TransformOne<Kind>(input[i], m); }
+		}
+
+		template <TransformKind Kind>
+		void Transform(std::span<const Vector<3>> input, std::span<Vector<3>> output, const Matrix<4>& matrix,
+		               std::size_t threadCount)
+		{
+			assert(input.size() == output.size());
+			const std::size_t count = input.size();
+
+			threadCount = std::min(threadCount, count / MinimumVectorsPerThread);
+			if (threadCount <= 1)
+			{
+				TransformRange<Kind>(input.data(), output.data(), count, matrix);
+				return;
+			}
+
+			// Rounded up to a multiple of four so only the last chunk has a scalar remainder.
+			const std::size_t chunkSize = (count / threadCount + 3) / 4 * 4;
+
+			// The calling thread takes the last chunk, and the destructors join the rest.
+			std::vector<std::jthread> threads;
+			threads.reserve(threadCount - 1);
+
+			std::size_t begin = 0;
+			for (std::size_t thread = 0; thread < threadCount - 1 && begin < count; ++thread)
+			{
+				const std::size_t size = std::min(chunkSize, count - begin);
+				threads.emplace_back(TransformRange<Kind>, input.data() + begin, output.data() + begin, size,
+				                     std::cref(matrix));
+				begin += size;
+			}
+
+			TransformRange<Kind>(input.data() + begin, output.data() + begin, count - begin, matrix);
+		}
+	}
+
+	/*
+	 * Batch Transforms
+	 * Transforms every vector in a span by the same matrix, equivalent to looping over
+	 * Vector<4>{x, y, z, w} * matrix but several times faster.
+	 * The output span must be the same size as the input, and may be the same span to transform in place, but must not
+	 * otherwise overlap it.
+	 * For large spans, \p threadCount splits the work between that many threads, including the calling thread. It's
+	 * reduced when there isn't enough work for each thread to cover the cost of starting it.
+	 */
+	/// Transforms positions, treating W as one so the matrix's translation applies.
+	inline void TransformPoints(std::span<const Vector<3>> points, std::span<Vector<3>> result, const Matrix<4>& matrix,
+	                            std::size_t threadCount = 1)
+	{
+		Detail::Transform<Detail::TransformKind::Point>(points, result, matrix, threadCount);
+	}
+
+	/// Transforms directions, treating W as zero so the matrix's translation is ignored.
+	inline void TransformDirections(std::span<const Vector<3>> directions, std::span<Vector<3>> result,
+	                                const Matrix<4>& matrix, std::size_t threadCount = 1)
+	{
+		Detail::Transform<Detail::TransformKind::Direction>(directions, result, matrix, threadCount);
+	}
+
+	/// Transforms surface normals by the inverse transpose of the matrix's upper 3x3 portion, so they stay
+	/// perpendicular to their surface under non-uniform scaling. \n
+	/// The results aren't normalised, as some uses only need the direction.
+	inline void TransformNormals(std::span<const Vector<3>> normals, std::span<Vector<3>> result,
+	                             const Matrix<4>& matrix, std::size_t threadCount = 1)
+	{
+		const Matrix<3> inverseTranspose = matrix.Submatrix(3, 3).Inverted().Transposed();
+
+		Matrix<4> normalMatrix{};
+		for (std::size_t row = 0; row < 3; ++row)
+		{
+			for (std::size_t column = 0; column < 3; ++column) { normalMatrix(row, column) = inverseTranspose(row, column); }
+		}
+
+		Detail::Transform<Detail::TransformKind::Direction>(normals, result, normalMatrix, threadCount);
+	}
+
+	/// Transforms positions, treating W as one, then divides by the resulting W. Used for projection matrices, where
+	/// the result is in normalised device coordinates.
+	inline void TransformPointsProjective(std::span<const Vector<3>> points, std::span<Vector<3>> result,
+	                                      const Matrix<4>& matrix, std::size_t threadCount = 1)
+	{
+		Detail::Transform<Detail::TransformKind::Projective>(points, result, matrix, threadCount);
+	}
+}
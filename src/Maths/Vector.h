@@ -1,11 +1,13 @@
 #pragma once
 #include "Maths.h"
+#include "SIMD.h"
 #include <algorithm>
 #include <array>
 #include <cassert>
 #include <cmath>
 #include <concepts>
 #include <cstddef>
+#include <type_traits>
 
 namespace Engine3
 {
@@ -54,6 +56,11 @@ namespace Engine3
 		/// A zero value when the vectors are perpendicular, or when one is a zero vector.
 		static constexpr T DotProduct(const Vector& lhs, const Vector& rhs)
 		{
+			if constexpr (IsVectorised)
+			{
+				if (!std::is_constant_evaluated()) { return SIMD::DotProduct(Load(lhs), Load(rhs)); }
+			}
+
 			// An integer squared is always an integer, no need to worry about precision loss when std::integral<T>,
 			// just need to not allow other typed vectors as lhs parameter.
 			T value = 0;
@@ -151,6 +158,11 @@ namespace Engine3
 		{
 			assert(!IsZero());
 
+			if constexpr (IsVectorised)
+			{
+				if (!std::is_constant_evaluated()) { return *this = NormalisedLanes(Load(*this)); }
+			}
+
 			// Multiply multiple times vs divide multiple times. This is probably better.
 			auto scale = 1 / Length();
 			*this *= scale;
@@ -165,6 +177,11 @@ namespace Engine3
 		{
 			assert(!IsZero());
 
+			if constexpr (IsVectorised)
+			{
+				if (!std::is_constant_evaluated()) { return NormalisedLanes(Load(*this)); }
+			}
+
 			// Multiply multiple times vs divide multiple times. This is probably better.
 			auto scale = 1 / Length();
 			return (*this) * scale;
@@ -205,6 +222,11 @@ namespace Engine3
 		/// @return A negated copy of the vector.
 		constexpr Vector operator-() const
 		{
+			if constexpr (IsVectorised)
+			{
+				if (!std::is_constant_evaluated()) { return Store(-Load(*this)); }
+			}
+
 			Vector negated;
 			for (size_t i = 0; i < Dimensions; ++i) { negated[i] = -(*this)[i]; }
 
@@ -214,6 +236,11 @@ namespace Engine3
 		/// Adds each corresponding element in two vectors together.
 		constexpr Vector& operator+=(const Vector& rhs)
 		{
+			if constexpr (IsVectorised)
+			{
+				if (!std::is_constant_evaluated()) { return *this = Store(Load(*this) + Load(rhs)); }
+			}
+
 			for (size_t i = 0; i < Dimensions; ++i) { (*this)[i] += rhs[i]; }
 			return *this;
 		}
@@ -224,6 +251,11 @@ namespace Engine3
 		/// Subtracts each component in the vector by the corresponding component in \p rhs.
 		constexpr Vector& operator-=(const Vector& rhs)
 		{
+			if constexpr (IsVectorised)
+			{
+				if (!std::is_constant_evaluated()) { return *this = Store(Load(*this) - Load(rhs)); }
+			}
+
 			for (size_t i = 0; i < Dimensions; ++i) { (*this)[i] -= rhs[i]; }
 			return *this;
 		}
@@ -237,6 +269,11 @@ namespace Engine3
 		/// @return A reference to the altered vector.
 		constexpr Vector& operator*=(T rhs)
 		{
+			if constexpr (IsVectorised)
+			{
+				if (!std::is_constant_evaluated()) { return *this = Store(Load(*this) * SIMD::Broadcast(rhs)); }
+			}
+
 			for (size_t i = 0; i < Dimensions; ++i) { (*this)[i] *= rhs; }
 			return *this;
 		}
@@ -258,6 +295,11 @@ namespace Engine3
 		/// @return A reference to the altered vector.
 		constexpr Vector& operator/=(T rhs)
 		{
+			if constexpr (IsVectorised)
+			{
+				if (!std::is_constant_evaluated()) { return *this = Store(Load(*this) / SIMD::Broadcast(rhs)); }
+			}
+
 			for (size_t i = 0; i < Dimensions; ++i) { (*this)[i] /= rhs; }
 			return *this;
 		}
@@ -330,6 +372,34 @@ namespace Engine3
 			static_assert(Index < Dimensions, "Index out of bounds");
 			return (*this)[Index];
 		}
+
+	private:
+		/*
+		 * SIMD
+		 *
+		 */
+		// The storage is left as a plain std::array so arrays of vectors can still be handed to OpenGL as is, values are
+		// moved in and out of a register around each operation instead.
+		// Vector<3> is deliberately excluded. Packing 12 bytes into a register and back costs more than the three scalar
+		// operations it replaces, see benchmark/Maths/Vector.cpp. Bulk Vector<3> work should go through the batch
+		// kernels instead, which transpose into structure-of-arrays form.
+		static constexpr bool IsVectorised = std::same_as<T, float> && Dimensions == 4;
+
+		static SIMD::Float4 Load(const Vector& vector) requires IsVectorised { return SIMD::Load(vector.data()); }
+
+		static Vector Store(SIMD::Float4 values) requires IsVectorised
+		{
+			Vector vector;
+			SIMD::Store(vector.data(), values);
+
+			return vector;
+		}
+
+		static Vector NormalisedLanes(SIMD::Float4 values) requires IsVectorised
+		{
+			const float scale = 1 / std::sqrt(SIMD::DotProduct(values, values));
+			return Store(values * SIMD::Broadcast(scale));
+		}
 	};
 
 	/// A quaternion can be computed by interpolating around the arc that connects two quaternions
@@ -0,0 +1,354 @@
+#pragma once
+#include "Maths.h"
+#include "SIMD.h"
+#include "Vector.h"
+#include "../Utility/AlignedAllocator.h"
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace Engine3
+{
+	/// A resizable collection of vectors stored as structure-of-arrays, one contiguous array per component. \n
+	/// Operating on a single Vector can only use as many SIMD lanes as it has components, whereas here each lane
+	/// holds a different vector so every lane does useful work, for any number of dimensions.
+	/// Intended for large sets, such as every entity's position, that are processed in bulk.
+	/// @tparam Dimensions The number of components in each vector.
+	/// @tparam T The type of each component.
+	template <std::size_t Dimensions, Number T = float>
+	class VectorStream
+	{
+	public:
+		/// Each component array starts on a cache line.
+		using ComponentArray = std::vector<T, AlignedAllocator<T, 64>>;
+
+	private:
+		std::array<ComponentArray, Dimensions> Components;
+
+		static constexpr bool IsVectorised = std::same_as<T, float>;
+
+	public:
+		/* Constructors */
+		VectorStream() = default;
+
+		/// @param size The number of vectors, each is zeroed.
+		explicit VectorStream(std::size_t size) { Resize(size); }
+
+		/// Copies \p vectors into the stream.
+		explicit VectorStream(std::span<const Vector<Dimensions, T>> vectors) { Load(vectors); }
+
+		/* Capacity */
+		std::size_t Size() const { return Components[0].size(); }
+
+		bool IsEmpty() const { return Components[0].empty(); }
+
+		/// Newly added vectors are zeroed.
+		void Resize(std::size_t size)
+		{
+			for (ComponentArray& component : Components) { component.resize(size); }
+		}
+
+		void Reserve(std::size_t capacity)
+		{
+			for (ComponentArray& component : Components) { component.reserve(capacity); }
+		}
+
+		void Clear()
+		{
+			for (ComponentArray& component : Components) { component.clear(); }
+		}
+
+		/* Element Access */
+		/// Gathers a single vector from each of the component arrays.
+		Vector<Dimensions, T> Get(std::size_t index) const
+		{
+			assert(index < Size());
+
+			Vector<Dimensions, T> vector;
+			for (std::size_t i = 0; i < Dimensions; ++i) { vector[i] = Components[i][index]; }
+
+			return vector;
+		}
+
+		/// Scatters a single vector into each of the component arrays.
+		void Set(std::size_t index, const Vector<Dimensions, T>& vector)
+		{
+			assert(index < Size());
+			for (std::size_t i = 0; i < Dimensions; ++i) { Components[i][index] = vector[i]; }
+		}
+
+		void PushBack(const Vector<Dimensions, T>& vector)
+		{
+			for (std::size_t i = 0; i < Dimensions; ++i) { Components[i].push_back(vector[i]); }
+		}
+
+		/// A view of every vector's \p component, where X is zero. \n
+		/// Unlike converting to and from Vector, this doesn't copy anything.
+		std::span<T> Component(std::size_t component)
+		{
+			assert(component < Dimensions);
+			return Components[component];
+		}
+
+		std::span<const T> Component(std::size_t component) const
+		{
+			assert(component < Dimensions);
+			return Components[component];
+		}
+
+		std::span<T> X() requires (Dimensions <= 4) { return Component(0); }
+		std::span<const T> X() const requires (Dimensions <= 4) { return Component(0); }
+		std::span<T> Y() requires (Dimensions <= 4 && Dimensions > 1) { return Component(1); }
+		std::span<const T> Y() const requires (Dimensions <= 4 && Dimensions > 1) { return Component(1); }
+		std::span<T> Z() requires (Dimensions <= 4 && Dimensions > 2) { return Component(2); }
+		std::span<const T> Z() const requires (Dimensions <= 4 && Dimensions > 2) { return Component(2); }
+		std::span<T> W() requires (Dimensions <= 4 && Dimensions > 3) { return Component(3); }
+		std::span<const T> W() const requires (Dimensions <= 4 && Dimensions > 3) { return Component(3); }
+
+		/*
+		 * Conversions
+		 * A span of Vector interleaves the components, so it can't share memory with a stream. These convert between
+		 * the two layouts in bulk, which for float vectors of three or four dimensions is done four at a time in
+		 * registers.
+		 */
+		/// Replaces the contents of the stream with \p vectors.
+		void Load(std::span<const Vector<Dimensions, T>> vectors)
+		{
+			Resize(vectors.size());
+
+			std::size_t i = 0;
+			if constexpr (IsVectorised && Dimensions == 3)
+			{
+				for (; i + 4 <= vectors.size(); i += 4)
+				{
+					SIMD::Float4 x, y, z;
+					SIMD::Deinterleave3(vectors[i].data(), x, y, z);
+					SIMD::Store(&Components[0][i], x);
+					SIMD::Store(&Components[1][i], y);
+					SIMD::Store(&Components[2][i], z);
+				}
+			}
+			else if constexpr (IsVectorised && Dimensions == 4)
+			{
+				for (; i + 4 <= vectors.size(); i += 4)
+				{
+					SIMD::Float4 rows[4];
+					for (std::size_t j = 0; j < 4; ++j) { rows[j] = SIMD::Load(vectors[i + j].data()); }
+					SIMD::Transpose(rows[0], rows[1], rows[2], rows[3]);
+					for (std::size_t j = 0; j < 4; ++j) { SIMD::Store(&Components[j][i], rows[j]); }
+				}
+			}
+
+			for (; i < vectors.size(); ++i) { Set(i, vectors[i]); }
+		}
+
+		/// Copies the stream into \p vectors, which must be the same size.
+		void Store(std::span<Vector<Dimensions, T>> vectors) const
+		{
+			assert(vectors.size() == Size());
+
+			std::size_t i = 0;
+			if constexpr (IsVectorised && Dimensions == 3)
+			{
+				for (; i + 4 <= vectors.size(); i += 4)
+				{
+					SIMD::Interleave3(vectors[i].data(), SIMD::Load(&Components[0][i]), SIMD::Load(&Components[1][i]),
+					                  SIMD::Load(&Components[2][i]));
+				}
+			}
+			else if constexpr (IsVectorised && Dimensions == 4)
+			{
+				for (; i + 4 <= vectors.size(); i += 4)
+				{
+					SIMD::Float4 columns[4];
+					for (std::size_t j = 0; j < 4; ++j) { columns[j] = SIMD::Load(&Components[j][i]); }
+					SIMD::Transpose(columns[0], columns[1], columns[2], columns[3]);
+					for (std::size_t j = 0; j < 4; ++j) { SIMD::Store(vectors[i + j].data(), columns[j]); }
+				}
+			}
+
+			for (; i < vectors.size(); ++i) { vectors[i] = Get(i); }
+		}
+
+		/*
+		 * Bulk Operations
+		 * Each mirrors the Vector method of the same name, applied to every vector in the stream. Components are summed
+		 * in order, X first, in both the vectorised loop and the scalar remainder.
+		 */
+		/// @param result The dot product of each pair of vectors, the same size as the streams.
+		static void DotProduct(const VectorStream& lhs, const VectorStream& rhs, std::span<T> result)
+		{
+			assert(lhs.Size() == rhs.Size() && result.size() == lhs.Size());
+
+			std::size_t i = 0;
+			if constexpr (IsVectorised)
+			{
+				for (; i + 4 <= result.size(); i += 4)
+				{
+					SIMD::Float4 sum = SIMD::Load(&lhs.Components[0][i]) * SIMD::Load(&rhs.Components[0][i]);
+					for (std::size_t j = 1; j < Dimensions; ++j)
+					{
+						sum = sum + SIMD::Load(&lhs.Components[j][i]) * SIMD::Load(&rhs.Components[j][i]);
+					}
+
+					SIMD::Store(&result[i], sum);
+				}
+			}
+
+			for (; i < result.size(); ++i)
+			{
+				T sum = lhs.Components[0][i] * rhs.Components[0][i];
+				for (std::size_t j = 1; j < Dimensions; ++j) { sum += lhs.Components[j][i] * rhs.Components[j][i]; }
+
+				result[i] = sum;
+			}
+		}
+
+		/// @param result The squared length of each vector, the same size as the stream.
+		void LengthSquared(std::span<T> result) const { DotProduct(*this, *this, result); }
+
+		/// Scales every vector to a length of one, none of which may be zero.
+		VectorStream& Normalise() requires std::floating_point<T>
+		{
+			const std::size_t size = Size();
+
+			std::size_t i = 0;
+			if constexpr (IsVectorised)
+			{
+				for (; i + 4 <= size; i += 4)
+				{
+					SIMD::Float4 components[Dimensions];
+					SIMD::Float4 lengthSquared = SIMD::Broadcast(0);
+					for (std::size_t j = 0; j < Dimensions; ++j)
+					{
+						components[j] = SIMD::Load(&Components[j][i]);
+						lengthSquared = lengthSquared + components[j] * components[j];
+					}
+
+					const SIMD::Float4 scale = SIMD::Broadcast(1) / SIMD::SquareRoot(lengthSquared);
+					for (std::size_t j = 0; j < Dimensions; ++j) { SIMD::Store(&Components[j][i], components[j] * scale); }
+				}
+			}
+
+			for (; i < size; ++i)
+			{
+				T lengthSquared = 0;
+				for (std::size_t j = 0; j < Dimensions; ++j) { lengthSquared += Components[j][i] * Components[j][i]; }
+
+				assert(lengthSquared != 0);
+				const T scale = 1 / std::sqrt(lengthSquared);
+				for (std::size_t j = 0; j < Dimensions; ++j) { Components[j][i] *= scale; }
+			}
+
+			return *this;
+		}
+
+		/// Interpolates each pair of vectors by the same \p fraction, see Engine3::LinearInterpolation.
+		/// @param result The same size as the streams, and may be either of them.
+		static void LinearInterpolation(const VectorStream& start, const VectorStream& end, T fraction,
+		                                VectorStream& result)
+		{
+			assert(start.Size() == end.Size() && result.Size() == start.Size());
+
+			for (std::size_t j = 0; j < Dimensions; ++j)
+			{
+				const T* startComponent = start.Components[j].data();
+				const T* endComponent = end.Components[j].data();
+				T* resultComponent = result.Components[j].data();
+
+				std::size_t i = 0;
+				if constexpr (IsVectorised)
+				{
+					const SIMD::Float4 fractions = SIMD::Broadcast(fraction);
+					for (; i + 4 <= start.Size(); i += 4)
+					{
+						const SIMD::Float4 from = SIMD::Load(startComponent + i);
+						SIMD::Store(resultComponent + i, from + fractions * (SIMD::Load(endComponent + i) - from));
+					}
+				}
+
+				for (; i < start.Size(); ++i)
+				{
+					resultComponent[i] = Engine3::LinearInterpolation(startComponent[i], endComponent[i], fraction);
+				}
+			}
+		}
+
+		/* Operators */
+		VectorStream& operator+=(const VectorStream& rhs)
+		{
+			assert(rhs.Size() == Size());
+
+			for (std::size_t j = 0; j < Dimensions; ++j)
+			{
+				T* lhsComponent = Components[j].data();
+				const T* rhsComponent = rhs.Components[j].data();
+
+				std::size_t i = 0;
+				if constexpr (IsVectorised)
+				{
+					for (; i + 4 <= Size(); i += 4)
+					{
+						SIMD::Store(lhsComponent + i, SIMD::Load(lhsComponent + i) + SIMD::Load(rhsComponent + i));
+					}
+				}
+
+				for (; i < Size(); ++i) { lhsComponent[i] += rhsComponent[i]; }
+			}
+
+			return *this;
+		}
+
+		VectorStream& operator-=(const VectorStream& rhs)
+		{
+			assert(rhs.Size() == Size());
+
+			for (std::size_t j = 0; j < Dimensions; ++j)
+			{
+				T* lhsComponent = Components[j].data();
+				const T* rhsComponent = rhs.Components[j].data();
+
+				std::size_t i = 0;
+				if constexpr (IsVectorised)
+				{
+					for (; i + 4 <= Size(); i += 4)
+					{
+						SIMD::Store(lhsComponent + i, SIMD::Load(lhsComponent + i) - SIMD::Load(rhsComponent + i));
+					}
+				}
+
+				for (; i < Size(); ++i) { lhsComponent[i] -= rhsComponent[i]; }
+			}
+
+			return *this;
+		}
+
+		/// Scales every vector by \p rhs.
+		VectorStream& operator*=(T rhs)
+		{
+			for (ComponentArray& component : Components)
+			{
+				std::size_t i = 0;
+				if constexpr (IsVectorised)
+				{
+					const SIMD::Float4 scale = SIMD::Broadcast(rhs);
+					for (; i + 4 <= Size(); i += 4)
+					{
+						SIMD::Store(&component[i], SIMD::Load(&component[i]) * scale);
+					}
+				}
+
+				for (; i < Size(); ++i) { component[i] *= rhs; }
+			}
+
+			return *this;
+		}
+
+		friend bool operator==(const VectorStream& lhs, const VectorStream& rhs) = default;
+	};
+}
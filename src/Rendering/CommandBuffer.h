@@ -0,0 +1,175 @@
+#pragma once
+#include "SortKey.h"
+#include "../Maths/Matrix.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace Engine3
+{
+	enum class CommandType : std::uint8_t
+	{
+		Draw,
+		SetTranslucent,
+		BindShader,
+		BindMesh,
+		DrawInstanced
+	};
+
+	/// An object to draw, to be sorted and batched with the rest of the frame's draws.
+	struct DrawCommand
+	{
+		static constexpr CommandType Type = CommandType::Draw;
+
+		/// Packed by SortKey::Pack.
+		std::uint64_t Key;
+
+		/// The world matrix, for row vectors.
+		Matrix<4> Transform;
+	};
+
+	/// Whether what follows is blended with what's behind it.
+	struct SetTranslucentCommand
+	{
+		static constexpr CommandType Type = CommandType::SetTranslucent;
+
+		bool IsTranslucent;
+	};
+
+	struct BindShaderCommand
+	{
+		static constexpr CommandType Type = CommandType::BindShader;
+
+		ShaderHandle Shader;
+	};
+
+	struct BindMeshCommand
+	{
+		static constexpr CommandType Type = CommandType::BindMesh;
+
+		MeshHandle Mesh;
+	};
+
+	/// Draws instances of the bound mesh with the bound shader.
+	struct DrawInstancedCommand
+	{
+		static constexpr CommandType Type = CommandType::DrawInstanced;
+
+		/// Into the instance transforms the commands are replayed with.
+		std::uint32_t FirstInstance;
+
+		std::uint32_t InstanceCount;
+	};
+
+	template <class T>
+	concept IsCommand = std::is_trivially_copyable_v<T> && std::same_as<decltype(T::Type), const CommandType>;
+
+	/// A stream of rendering commands, recorded without touching OpenGL so that any thread can record one, and replayed
+	/// on the thread with the context. \n
+	/// Commands are plain data, each after a small header, appended to one block of memory like a linear allocator.
+	/// Clearing it only resets the end, so a buffer reused every frame stops allocating once it's large enough. \n
+	/// A buffer mustn't be used by more than one thread at once, so each thread records into its own.
+	class CommandBuffer
+	{
+	private:
+		struct Header
+		{
+			CommandType Type;
+
+			// Of the header and the command, so the next header is found without knowing every command's size.
+			std::uint32_t Size;
+		};
+
+		// Every header and command starts on a multiple of this.
+		static constexpr std::size_t Alignment = 8;
+
+		static constexpr std::size_t Align(std::size_t size) { return (size + Alignment - 1) / Alignment * Alignment; }
+
+		std::vector<std::byte> Bytes;
+
+		std::size_t Count = 0;
+
+	public:
+		/* METHODS */
+		template <IsCommand T>
+		void Record(const T& command)
+		{
+			static_assert(alignof(T) <= Alignment);
+
+			constexpr std::size_t commandOffset = Align(sizeof(Header));
+			constexpr std::size_t size = commandOffset + Align(sizeof(T));
+
+			const std::size_t offset = Bytes.size();
+			Bytes.resize(offset + size);
+
+			const Header header{T::Type, static_cast<std::uint32_t>(size)};
+			std::memcpy(Bytes.data() + offset, &header, sizeof(Header));
+			std::memcpy(Bytes.data() + offset + commandOffset, &command, sizeof(T));
+			++Count;
+		}
+
+		/// Records an object to draw.
+		void Draw(const SortKey& key, const Matrix<4>& transform) { Record(DrawCommand{key.Pack(), transform}); }
+
+		/// @return The number of commands recorded since the last Clear.
+		std::size_t Size() const { return Count; }
+
+		/// @return The bytes the commands take up, which is all the memory used by them.
+		std::size_t GetByteSize() const { return Bytes.size(); }
+
+		bool IsEmpty() const { return Count == 0; }
+
+		/// Removes every command, keeping the memory for reuse.
+		void Clear()
+		{
+			Bytes.clear();
+			Count = 0;
+		}
+
+		/// Calls \p visitor with each command in the order it was recorded, as its own type.
+		template <class Visitor>
+		void ForEach(Visitor&& visitor) const
+		{
+			std::size_t offset = 0;
+			while (offset < Bytes.size())
+			{
+				Header header;
+				std::memcpy(&header, Bytes.data() + offset, sizeof(Header));
+				const std::byte* command = Bytes.data() + offset + Align(sizeof(Header));
+
+				switch (header.Type)
+				{
+				case CommandType::Draw:
+					visitor(Read<DrawCommand>(command));
+					break;
+				case CommandType::SetTranslucent:
+					visitor(Read<SetTranslucentCommand>(command));
+					break;
+				case CommandType::BindShader:
+					visitor(Read<BindShaderCommand>(command));
+					break;
+				case CommandType::BindMesh:
+					visitor(Read<BindMeshCommand>(command));
+					break;
+				case CommandType::DrawInstanced:
+					visitor(Read<DrawInstancedCommand>(command));
+					break;
+				}
+
+				offset += header.Size;
+			}
+		}
+
+	private:
+		// Copied out rather than cast, as the bytes were never an object of that type.
+		template <IsCommand T>
+		static T Read(const std::byte* command)
+		{
+			T result;
+			std::memcpy(&result, command, sizeof(T));
+			return result;
+		}
+	};
+}
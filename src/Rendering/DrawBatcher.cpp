@@ -0,0 +1,71 @@
+#include "DrawBatcher.h"
+#include "../Utility/RadixSort.h"
+#include <concepts>
+
+void Engine3::DrawBatcher::Submit(const CommandBuffer& commands)
+{
+	commands.ForEach([this]<class T>(const T& command)
+	{
+		if constexpr (std::same_as<T, DrawCommand>)
+		{
+			Draws.push_back({command.Key, static_cast<std::uint32_t>(Transforms.size())});
+			Transforms.push_back(command.Transform);
+		}
+	});
+}
+
+void Engine3::DrawBatcher::Build()
+{
+	Scratch.resize(Draws.size());
+	RadixSort(std::span{Draws}, std::span{Scratch}, [](const Draw& draw) { return draw.Key; });
+
+	Batches.clear();
+	Instances.resize(Draws.size());
+	Stats = {};
+	Stats.Draws = Draws.size();
+
+	std::uint64_t state = 0;
+	for (std::uint32_t i = 0; i < Draws.size(); ++i)
+	{
+		// Draws are only batched while they're consecutive, so translucent ones stay in order of depth.
+		const std::uint64_t drawState = SortKey::WithoutDepth(Draws[i].Key);
+		if (Batches.empty() || drawState != state)
+		{
+			const SortKey key = SortKey::Unpack(Draws[i].Key);
+			const DrawBatch* previous = Batches.empty() ? nullptr : &Batches.back();
+
+			if (previous && previous->Shader == key.Shader) { ++Stats.ShaderBindsAvoided; }
+			else { ++Stats.ShaderBinds; }
+
+			if (previous && previous->Mesh == key.Mesh) { ++Stats.MeshBindsAvoided; }
+			else { ++Stats.MeshBinds; }
+
+			Batches.push_back({key.Layer, key.IsTranslucent, key.Shader, key.Material, key.Mesh, i, 0});
+			state = drawState;
+		}
+
+		Instances[i] = Transforms[Draws[i].Transform];
+		++Batches.back().InstanceCount;
+	}
+
+	Stats.Batches = Batches.size();
+}
+
+void Engine3::DrawBatcher::Encode(CommandBuffer& commands) const
+{
+	const DrawBatch* previous = nullptr;
+	for (const DrawBatch& batch : Batches)
+	{
+		if (!previous || previous->IsTranslucent != batch.IsTranslucent)
+		{
+			commands.Record(SetTranslucentCommand{batch.IsTranslucent});
+		}
+
+		if (!previous || previous->Shader != batch.Shader) { commands.Record(BindShaderCommand{batch.Shader}); }
+
+		if (!previous || previous->Mesh != batch.Mesh) { commands.Record(BindMeshCommand{batch.Mesh}); }
+
+		commands.Record(DrawInstancedCommand{batch.FirstInstance, batch.InstanceCount});
+		previous = &batch;
+	}
+}
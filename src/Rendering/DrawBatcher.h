@@ -0,0 +1,114 @@
+#pragma once
+#include "CommandBuffer.h"
+#include "SortKey.h"
+#include "../Maths/Matrix.h"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Engine3
+{
+	/// Instances of one mesh with one material, drawn with a single instanced draw call.
+	struct DrawBatch
+	{
+		std::uint32_t Layer;
+
+		bool IsTranslucent;
+
+		ShaderHandle Shader;
+
+		MaterialHandle Material;
+
+		MeshHandle Mesh;
+
+		/// Where the batch's transforms start in DrawBatcher::GetInstanceTransforms.
+		std::uint32_t FirstInstance;
+
+		std::uint32_t InstanceCount;
+	};
+
+	/// How much state the batches of the last DrawBatcher::Build need changed, and how much sorting saved.
+	struct DrawStats
+	{
+		/// Each of which would be a draw call, and changing the shader and mesh, without batching.
+		std::size_t Draws = 0;
+
+		/// The number of draw calls.
+		std::size_t Batches = 0;
+
+		std::size_t ShaderBinds = 0;
+
+		/// Batches that use the same shader as the one before, so it's left bound.
+		std::size_t ShaderBindsAvoided = 0;
+
+		std::size_t MeshBinds = 0;
+
+		/// Batches that use the same mesh as the one before, so it's left bound.
+		std::size_t MeshBindsAvoided = 0;
+	};
+
+	/// The render queue, which collects a frame's draws, each with a SortKey, then sorts them and groups consecutive
+	/// draws with the same state, so each group is one instanced draw call with its transforms in one contiguous
+	/// buffer, and the state only changes between groups that differ. \n
+	/// Knows nothing of OpenGL, the batches are encoded as commands for a RenderBackend to replay.
+	class DrawBatcher
+	{
+	private:
+		struct Draw
+		{
+			std::uint64_t Key;
+
+			// Into Transforms, so sorting only moves the small draws around rather than every transform.
+			std::uint32_t Transform;
+		};
+
+		std::vector<Draw> Draws;
+		std::vector<Draw> Scratch;
+		std::vector<Matrix<4>> Transforms;
+
+		std::vector<DrawBatch> Batches;
+		std::vector<Matrix<4>> Instances;
+
+		DrawStats Stats;
+
+	public:
+		/* METHODS */
+		/// @param transform The object's world matrix, for row vectors.
+		void Submit(const SortKey& key, const Matrix<4>& transform)
+		{
+			Draws.push_back({key.Pack(), static_cast<std::uint32_t>(Transforms.size())});
+			Transforms.push_back(transform);
+		}
+
+		/// Submits every DrawCommand in \p commands, e.g. one recorded by another thread. Buffers should be submitted in
+		/// the same order each frame, as draws with equal keys are drawn in the order they're submitted.
+		void Submit(const CommandBuffer& commands);
+
+		/// @return The number of draws submitted since the last Clear.
+		std::size_t Size() const { return Draws.size(); }
+
+		/// Sorts every draw submitted since the last Clear by its key, and groups them into batches, replacing the
+		/// previous batches. Draws with equal keys keep the order they were submitted in.
+		void Build();
+
+		/// @return The batches from the last Build, in the order to draw them.
+		std::span<const DrawBatch> GetBatches() const { return Batches; }
+
+		/// Records the state changes and draw calls for the batches from the last Build onto the end of \p commands,
+		/// only changing state between batches that differ.
+		void Encode(CommandBuffer& commands) const;
+
+		/// @return Every batch's transforms, contiguous in the order of the batches, to upload in one go.
+		std::span<const Matrix<4>> GetInstanceTransforms() const { return Instances; }
+
+		const DrawStats& GetStats() const { return Stats; }
+
+		/// Removes every submitted draw, keeping the memory for the next frame.
+		void Clear()
+		{
+			Draws.clear();
+			Transforms.clear();
+		}
+	};
+}
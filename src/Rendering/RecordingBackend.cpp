@@ -0,0 +1,66 @@
+#include "RecordingBackend.h"
+#include <format>
+
+void Engine3::RecordingBackend::Begin(std::span<const Matrix<4>> instances)
+{
+	Commands.clear();
+	Errors.clear();
+	InstanceCount = instances.size();
+	Shader.reset();
+	Mesh.reset();
+	DrawCallCount = 0;
+	RedundantBindCount = 0;
+}
+
+void Engine3::RecordingBackend::Execute(const DrawCommand& command)
+{
+	Commands.emplace_back(command);
+	Errors.push_back(std::format("Command {}: draw wasn't batched.", Commands.size() - 1));
+}
+
+void Engine3::RecordingBackend::Execute(const SetTranslucentCommand& command) { Commands.emplace_back(command); }
+
+void Engine3::RecordingBackend::Execute(const BindShaderCommand& command)
+{
+	Commands.emplace_back(command);
+	if (command.Shader >= ShaderCount)
+	{
+		Errors.push_back(std::format("Command {}: shader {} doesn't exist.", Commands.size() - 1, command.Shader));
+	}
+
+	if (Shader == command.Shader) { ++RedundantBindCount; }
+	Shader = command.Shader;
+}
+
+void Engine3::RecordingBackend::Execute(const BindMeshCommand& command)
+{
+	Commands.emplace_back(command);
+	if (command.Mesh >= MeshCount)
+	{
+		Errors.push_back(std::format("Command {}: mesh {} doesn't exist.", Commands.size() - 1, command.Mesh));
+	}
+
+	if (Mesh == command.Mesh) { ++RedundantBindCount; }
+	Mesh = command.Mesh;
+}
+
+void Engine3::RecordingBackend::Execute(const DrawInstancedCommand& command)
+{
+	Commands.emplace_back(command);
+	const std::size_t index = Commands.size() - 1;
+
+	if (!Shader) { Errors.push_back(std::format("Command {}: drawn without a shader bound.", index)); }
+	if (!Mesh) { Errors.push_back(std::format("Command {}: drawn without a mesh bound.", index)); }
+	if (command.InstanceCount == 0) { Errors.push_back(std::format("Command {}: draws no instances.", index)); }
+
+	if (static_cast<std::size_t>(command.FirstInstance) + command.InstanceCount > InstanceCount)
+	{
+		Errors.push_back(std::format("Command {}: instances {} to {} are past the {} there are.", index,
+		                             command.FirstInstance, command.FirstInstance + command.InstanceCount,
+		                             InstanceCount));
+	}
+
+	++DrawCallCount;
+}
+
+void Engine3::RecordingBackend::End() {}
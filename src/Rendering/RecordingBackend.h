@@ -0,0 +1,74 @@
+#pragma once
+#include "CommandBuffer.h"
+#include "RenderBackend.h"
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace Engine3
+{
+	using RecordedCommand = std::variant<DrawCommand, SetTranslucentCommand, BindShaderCommand, BindMeshCommand,
+	                                     DrawInstancedCommand>;
+
+	/// Replays commands without a GPU, keeping each one and checking the stream is one OpenGL could carry out, e.g. that
+	/// nothing is drawn before a shader and mesh are bound, so what the renderer records can be tested.
+	class RecordingBackend final : public RenderBackend
+	{
+	private:
+		std::size_t ShaderCount;
+
+		std::size_t MeshCount;
+
+		std::vector<RecordedCommand> Commands;
+
+		std::vector<std::string> Errors;
+
+		std::size_t InstanceCount = 0;
+
+		std::optional<ShaderHandle> Shader;
+
+		std::optional<MeshHandle> Mesh;
+
+		std::size_t DrawCallCount = 0;
+
+		std::size_t RedundantBindCount = 0;
+
+	public:
+		/* CONSTRUCTORS */
+		/// @param shaderCount The number of shaders there are, so binding any other is an error.
+		/// @param meshCount The number of meshes there are, so binding any other is an error.
+		RecordingBackend(std::size_t shaderCount, std::size_t meshCount) :
+			ShaderCount(shaderCount), MeshCount(meshCount) {}
+
+		/* METHODS */
+		void Begin(std::span<const Matrix<4>> instances) override;
+
+		void Execute(const DrawCommand& command) override;
+
+		void Execute(const SetTranslucentCommand& command) override;
+
+		void Execute(const BindShaderCommand& command) override;
+
+		void Execute(const BindMeshCommand& command) override;
+
+		void Execute(const DrawInstancedCommand& command) override;
+
+		void End() override;
+
+		/// @return Every command replayed since the last Begin, in order.
+		std::span<const RecordedCommand> GetCommands() const { return Commands; }
+
+		/// @return A description of each problem with the commands replayed since the last Begin.
+		std::span<const std::string> GetErrors() const { return Errors; }
+
+		bool IsValid() const { return Errors.empty(); }
+
+		std::size_t GetDrawCallCount() const { return DrawCallCount; }
+
+		/// @return How many times the shader or mesh was bound while already bound, which is valid but wasted.
+		std::size_t GetRedundantBindCount() const { return RedundantBindCount; }
+	};
+}
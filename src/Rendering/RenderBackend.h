@@ -0,0 +1,43 @@
+#pragma once
+#include "CommandBuffer.h"
+#include "../Maths/Matrix.h"
+#include <span>
+
+namespace Engine3
+{
+	/// Carries out the commands in a CommandBuffer, e.g. by making the OpenGL calls for them on the thread with the
+	/// context, or by checking them without a GPU.
+	class RenderBackend
+	{
+	public:
+		/* CONSTRUCTORS */
+		virtual ~RenderBackend() = default;
+
+		/* METHODS */
+		/// Called before any command.
+		/// @param instances The transforms DrawInstancedCommand refers to.
+		virtual void Begin(std::span<const Matrix<4>> instances) = 0;
+
+		/// Draws have to be batched by DrawBatcher before they can be replayed, so this is an error in the stream.
+		virtual void Execute(const DrawCommand& command) = 0;
+
+		virtual void Execute(const SetTranslucentCommand& command) = 0;
+
+		virtual void Execute(const BindShaderCommand& command) = 0;
+
+		virtual void Execute(const BindMeshCommand& command) = 0;
+
+		virtual void Execute(const DrawInstancedCommand& command) = 0;
+
+		/// Called after every command, to leave any state as it was before Begin.
+		virtual void End() = 0;
+	};
+
+	/// Passes every command in \p commands to \p backend in the order they were recorded.
+	inline void Replay(const CommandBuffer& commands, std::span<const Matrix<4>> instances, RenderBackend& backend)
+	{
+		backend.Begin(instances);
+		commands.ForEach([&backend](const auto& command) { backend.Execute(command); });
+		backend.End();
+	}
+}
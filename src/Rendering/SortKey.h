@@ -0,0 +1,116 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+
+namespace Engine3
+{
+	/// Identifies a mesh added to the renderer.
+	using MeshHandle = std::uint32_t;
+
+	/// Identifies a material added to the renderer, which is drawn with a shader.
+	using MaterialHandle = std::uint32_t;
+
+	/// Identifies a shader program added to the renderer.
+	using ShaderHandle = std::uint32_t;
+
+	/// Everything that decides the order a draw is made in, packed into one integer so sorting the integers sorts by
+	/// all of it at once. From the most significant bits: \n
+	/// Opaque: layer, translucent (0), shader, material, mesh, depth. \n
+	/// Translucent: layer, translucent (1), depth, shader, material, mesh. \n
+	/// Opaque draws with the same state end up next to each other, nearest first so less is shaded that's hidden.
+	/// Translucent draws come after, furthest first so they blend correctly, which matters more than state changes.
+	struct SortKey
+	{
+		static constexpr int LayerBits = 4;
+		static constexpr int ShaderBits = 10;
+		static constexpr int MaterialBits = 14;
+		static constexpr int MeshBits = 17;
+		static constexpr int DepthBits = 18;
+
+		static_assert(LayerBits + 1 + ShaderBits + MaterialBits + MeshBits + DepthBits == 64);
+
+		static constexpr std::uint64_t MaximumDepth = (std::uint64_t{1} << DepthBits) - 1;
+
+		/// How many of each fit in their bits, any handle or layer must be less.
+		static constexpr std::uint32_t LayerCount = 1u << LayerBits;
+		static constexpr std::uint32_t ShaderCount = 1u << ShaderBits;
+		static constexpr std::uint32_t MaterialCount = 1u << MaterialBits;
+		static constexpr std::uint32_t MeshCount = 1u << MeshBits;
+
+		/// Drawn in order of layer before anything else, e.g. the world and then the interface.
+		std::uint32_t Layer = 0;
+
+		bool IsTranslucent = false;
+
+		ShaderHandle Shader = 0;
+
+		MaterialHandle Material = 0;
+
+		MeshHandle Mesh = 0;
+
+		/// The distance from the camera, from zero at the near plane to one at the far plane.
+		float Depth = 0;
+
+		/* METHODS */
+		/// Each field is cut down to its bits, so one that's out of range can't spill into the others, though it won't
+		/// unpack the same. A depth that isn't a number is packed as zero.
+		constexpr std::uint64_t Pack() const
+		{
+			// Not a number fails the comparison, so it's zero rather than converted to an integer, which is undefined.
+			const float clamped = Depth > 0.f ? std::min(Depth, 1.f) : 0.f;
+			const std::uint64_t depth = static_cast<std::uint64_t>(clamped * MaximumDepth);
+			const std::uint64_t state = (Shader & Mask(ShaderBits)) << (MaterialBits + MeshBits) |
+				(Material & Mask(MaterialBits)) << MeshBits | (Mesh & Mask(MeshBits));
+
+			std::uint64_t key = (Layer & Mask(LayerBits)) << (64 - LayerBits);
+			if (IsTranslucent)
+			{
+				key |= std::uint64_t{1} << (63 - LayerBits);
+				key |= (MaximumDepth - depth) << (ShaderBits + MaterialBits + MeshBits) | state;
+			}
+			else { key |= state << DepthBits | depth; }
+
+			return key;
+		}
+
+		/// The depth is only as precise as it was packed.
+		static constexpr SortKey Unpack(std::uint64_t key)
+		{
+			constexpr int stateBits = ShaderBits + MaterialBits + MeshBits;
+
+			SortKey unpacked;
+			unpacked.Layer = static_cast<std::uint32_t>(key >> (64 - LayerBits));
+			unpacked.IsTranslucent = key >> (63 - LayerBits) & 1;
+
+			std::uint64_t state;
+			std::uint64_t depth;
+			if (unpacked.IsTranslucent)
+			{
+				state = key & Mask(stateBits);
+				depth = MaximumDepth - (key >> stateBits & MaximumDepth);
+			}
+			else
+			{
+				state = key >> DepthBits & Mask(stateBits);
+				depth = key & MaximumDepth;
+			}
+
+			unpacked.Shader = static_cast<ShaderHandle>(state >> (MaterialBits + MeshBits));
+			unpacked.Material = static_cast<MaterialHandle>(state >> MeshBits & Mask(MaterialBits));
+			unpacked.Mesh = static_cast<MeshHandle>(state & Mask(MeshBits));
+			unpacked.Depth = static_cast<float>(depth) / MaximumDepth;
+			return unpacked;
+		}
+
+		/// @return \p key without its depth, so draws that can be made together compare equal.
+		static constexpr std::uint64_t WithoutDepth(std::uint64_t key)
+		{
+			const bool isTranslucent = key >> (63 - LayerBits) & 1;
+			const int shift = isTranslucent ? ShaderBits + MaterialBits + MeshBits : 0;
+			return key & ~(MaximumDepth << shift);
+		}
+
+	private:
+		static constexpr std::uint64_t Mask(int bits) { return (std::uint64_t{1} << bits) - 1; }
+	};
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include "../Maths/Matrix.h"
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace Engine3
+{
+	/// The binding point each uniform block is bound to, which is the same in every shader, so a block is bound once
+	/// for all of them rather than set in each.
+	enum class UniformBinding : std::uint32_t
+	{
+		Camera = 0
+	};
+
+	/// Laid out as the Camera block in the shaders, declared `layout(std140, row_major)`, so it's uploaded as it is.
+	/// Row major means a matrix's rows are read as they're stored, so nothing needs transposing on the way. \n
+	/// Under std140 a mat4 is four vec4s, each 16 byte aligned, which Matrix<4> already is.
+	struct alignas(16) CameraUniforms
+	{
+		/// From the camera to clip space, for column vectors.
+		Matrix<4> Perspective = Matrix<4>::Identity();
+
+		/// From the world to the camera, for row vectors like every other transform.
+		Matrix<4> View = Matrix<4>::Identity();
+	};
+
+	static_assert(std::is_trivially_copyable_v<CameraUniforms> && std::is_standard_layout_v<CameraUniforms>);
+	static_assert(sizeof(Matrix<4>) == 64);
+	static_assert(offsetof(CameraUniforms, View) == 64 && sizeof(CameraUniforms) == 128);
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <optional>
+
+namespace Engine3
+{
+	/// Hands out space in a buffer split into a region for each frame in flight, so the CPU writes one frame's data
+	/// while the GPU may still be reading the frames before it. Each region is allocated from linearly and all of it is
+	/// freed at once when its frame comes around again, which the caller must only do once the GPU is done with it. \n
+	/// Knows nothing of OpenGL, it only decides where things go.
+	class UploadRing
+	{
+	public:
+		/// The largest alignment an allocation can ask for, which every region starts on. OpenGL requires at most this
+		/// for uniform buffer offsets.
+		static constexpr std::size_t MaximumAlignment = 256;
+
+	private:
+		std::size_t FrameSize;
+
+		std::size_t FrameCount;
+
+		std::size_t Frame = 0;
+
+		// Bytes allocated from the current frame's region, including padding.
+		std::size_t Used = 0;
+
+	public:
+		/* CONSTRUCTORS */
+		/// @param frameSize The size of each frame's region, rounded up to MaximumAlignment.
+		/// @param frameCount How many frames can be in flight at once.
+		explicit UploadRing(std::size_t frameSize, std::size_t frameCount = 3) :
+			FrameSize((frameSize + MaximumAlignment - 1) / MaximumAlignment * MaximumAlignment), FrameCount(frameCount)
+		{
+			assert(frameCount > 0);
+		}
+
+		/* METHODS */
+		/// @return The size of the buffer the regions are in.
+		std::size_t GetSize() const { return FrameSize * FrameCount; }
+
+		std::size_t GetFrameSize() const { return FrameSize; }
+
+		std::size_t GetFrameCount() const { return FrameCount; }
+
+		/// @return The index of the current frame's region.
+		std::size_t GetFrame() const { return Frame; }
+
+		/// @return Where the current frame's region starts in the buffer.
+		std::size_t GetFrameOffset() const { return Frame * FrameSize; }
+
+		/// @return The bytes allocated from the current frame's region so far.
+		std::size_t GetUsed() const { return Used; }
+
+		/// @param alignment A power of two no larger than MaximumAlignment, which the returned offset is a multiple of.
+		/// @return The offset of \p size bytes in the buffer, or nothing if they don't fit in the rest of the frame's
+		/// region.
+		std::optional<std::size_t> Allocate(std::size_t size, std::size_t alignment = 16)
+		{
+			assert(std::has_single_bit(alignment) && alignment <= MaximumAlignment);
+
+			const std::size_t offset = (Used + alignment - 1) & ~(alignment - 1);
+			if (offset > FrameSize || size > FrameSize - offset) { return std::nullopt; }
+
+			Used = offset + size;
+			return GetFrameOffset() + offset;
+		}
+
+		/// Moves on to the next frame's region, freeing everything allocated from it the last time around.
+		void NextFrame()
+		{
+			Frame = (Frame + 1) % FrameCount;
+			Used = 0;
+		}
+	};
+}
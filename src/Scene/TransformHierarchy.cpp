@@ -0,0 +1,106 @@
+#include "TransformHierarchy.h"
+#include <algorithm>
+#include <cassert>
+
+Engine3::Matrix<4> Engine3::LocalTransform::ToMatrix() const
+{
+	// With row vectors scaling first multiplies each row of the rotation by its scale factor, and translating last
+	// sets the bottom row.
+	Matrix<4> matrix = Rotation.ToMatrix<4>();
+	for (std::size_t row = 0; row < 3; ++row)
+	{
+		for (std::size_t column = 0; column < 3; ++column) { matrix(row, column) *= Scale[row]; }
+	}
+
+	matrix(3, 0) = Translation.X();
+	matrix(3, 1) = Translation.Y();
+	matrix(3, 2) = Translation.Z();
+
+	return matrix;
+}
+
+void Engine3::TransformHierarchy::MarkDirty(Index node)
+{
+	assert(node < Size());
+
+	Dirty[node] = true;
+	FirstDirty = std::min(FirstDirty, node);
+}
+
+Engine3::TransformHierarchy::Index Engine3::TransformHierarchy::Add(const LocalTransform& local, Index parent)
+{
+	assert(parent == NoParent || parent < Size());
+	assert(Size() < NoParent);
+
+	const auto node = static_cast<Index>(Size());
+	Parents.push_back(parent);
+	LocalTransforms.push_back(local);
+	WorldMatrices.push_back(Matrix<4>::Identity());
+	Dirty.push_back(false);
+	MarkDirty(node);
+
+	return node;
+}
+
+void Engine3::TransformHierarchy::Reserve(std::size_t capacity)
+{
+	Parents.reserve(capacity);
+	LocalTransforms.reserve(capacity);
+	WorldMatrices.reserve(capacity);
+	Dirty.reserve(capacity);
+}
+
+void Engine3::TransformHierarchy::Clear()
+{
+	Parents.clear();
+	LocalTransforms.clear();
+	WorldMatrices.clear();
+	Dirty.clear();
+	FirstDirty = 0;
+}
+
+void Engine3::TransformHierarchy::SetLocal(Index node, const LocalTransform& local)
+{
+	MarkDirty(node);
+	LocalTransforms[node] = local;
+}
+
+void Engine3::TransformHierarchy::SetTranslation(Index node, const Vector<3>& translation)
+{
+	MarkDirty(node);
+	LocalTransforms[node].Translation = translation;
+}
+
+void Engine3::TransformHierarchy::SetRotation(Index node, const Quaternion<float>& rotation)
+{
+	assert(rotation.IsUnit());
+
+	MarkDirty(node);
+	LocalTransforms[node].Rotation = rotation;
+}
+
+void Engine3::TransformHierarchy::SetScale(Index node, const Vector<3>& scale)
+{
+	MarkDirty(node);
+	LocalTransforms[node].Scale = scale;
+}
+
+void Engine3::TransformHierarchy::Update()
+{
+	const auto size = static_cast<Index>(Size());
+	for (Index node = FirstDirty; node < size; ++node)
+	{
+		const Index parent = Parents[node];
+
+		// Parents come first, so a dirty parent has already been recomputed and its flag not yet cleared.
+		if (parent != NoParent) { Dirty[node] |= Dirty[parent]; }
+		if (!Dirty[node]) { continue; }
+
+		const Matrix<4> local = LocalTransforms[node].ToMatrix();
+		WorldMatrices[node] = parent == NoParent ? local : local * WorldMatrices[parent];
+	}
+
+	// Cleared afterwards as children rely on their parent's flag during the pass.
+	std::fill(Dirty.begin() + FirstDirty, Dirty.end(), false);
+	FirstDirty = size;
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include "../Maths/Matrix.h"
+#include "../Maths/Quaternion.h"
+#include "../Maths/Vector.h"
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace Engine3
+{
+	/// A transform relative to its parent, applied as scale, then rotation, then translation.
+	struct LocalTransform
+	{
+		Vector<3> Translation{0, 0, 0};
+		Quaternion<float> Rotation = Quaternion<float>::Identity();
+		Vector<3> Scale{1, 1, 1};
+
+		/// @return The equivalent matrix for row vectors, which avoids multiplying the three separate matrices.
+		Matrix<4> ToMatrix() const;
+	};
+
+	/// Owns the transform of every node in a scene, each stored in flat arrays indexed by node. \n
+	/// Nodes are kept sorted so that a parent always comes before its children, which lets a single forward pass
+	/// recompute world matrices, as a parent's is always up to date by the time its children are reached. \n
+	/// Changing a local transform only marks the node as dirty, so only the dirty subtrees are recomputed by Update.
+	class TransformHierarchy
+	{
+	public:
+		using Index = std::uint32_t;
+
+		/// The parent of a root node.
+		static constexpr Index NoParent = std::numeric_limits<Index>::max();
+
+	private:
+		std::vector<Index> Parents;
+		std::vector<LocalTransform> LocalTransforms;
+		std::vector<Matrix<4>> WorldMatrices;
+
+		// Set when a node's local transform has changed, and during Update when its parent's world matrix has.
+		// Bytes rather than std::vector<bool> so that the update loop doesn't need to unpack bits.
+		std::vector<std::uint8_t> Dirty;
+
+		// Every node before this is clean, so Update can skip them without checking.
+		Index FirstDirty = 0;
+
+		void MarkDirty(Index node);
+
+	public:
+		/* Nodes */
+		/// @param parent Must already be in the hierarchy, which keeps parents before their children.
+		/// @return The new node, which is dirty until the next Update.
+		Index Add(const LocalTransform& local = {}, Index parent = NoParent);
+
+		std::size_t Size() const { return Parents.size(); }
+
+		void Reserve(std::size_t capacity);
+
+		void Clear();
+
+		Index GetParent(Index node) const { return Parents[node]; }
+
+		/* Local Transforms */
+		const LocalTransform& GetLocal(Index node) const { return LocalTransforms[node]; }
+
+		void SetLocal(Index node, const LocalTransform& local);
+
+		void SetTranslation(Index node, const Vector<3>& translation);
+
+		/// @param rotation Must be a unit quaternion.
+		void SetRotation(Index node, const Quaternion<float>& rotation);
+
+		void SetScale(Index node, const Vector<3>& scale);
+
+		/* World Transforms */
+		/// @return Whether any node has changed since the last Update.
+		bool IsDirty() const { return FirstDirty < Size(); }
+
+		/// Recomputes the world matrix of every dirty node and all of their descendants.
+		void Update();
+
+		/// Only valid after an Update since the node, or any of its ancestors, was last changed.
+		const Matrix<4>& GetWorldMatrix(Index node) const { return WorldMatrices[node]; }
+
+		/// Every world matrix indexed by node, for example to upload in one go.
+		std::span<const Matrix<4>> GetWorldMatrices() const { return WorldMatrices; }
+	};
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstddef>
+#include <new>
+
+namespace Engine3
+{
+	/// Allocator for standard containers that aligns every allocation to \p Alignment bytes, for example so that SIMD
+	/// loops can start on a cache line.
+	/// @tparam T The type of each element allocated.
+	/// @tparam Alignment The alignment in bytes, a power of two that's at least the natural alignment of \p T.
+	template <class T, std::size_t Alignment = 64>
+		requires ((Alignment & (Alignment - 1)) == 0 && Alignment >= alignof(T))
+	struct AlignedAllocator
+	{
+		using value_type = T;
+
+		// Required as the alignment is a non-type template parameter, so std::allocator_traits can't deduce it.
+		template <class U>
+		struct rebind
+		{
+			using other = AlignedAllocator<U, Alignment>;
+		};
+
+		constexpr AlignedAllocator() noexcept = default;
+
+		template <class U>
+		constexpr AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+		[[nodiscard]] T* allocate(std::size_t count)
+		{
+			return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{Alignment}));
+		}
+
+		void deallocate(T* pointer, std::size_t count) noexcept
+		{
+			::operator delete(pointer, count * sizeof(T), std::align_val_t{Alignment});
+		}
+
+		template <class U>
+		constexpr bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept { return true; }
+	};
+}
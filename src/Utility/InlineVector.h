@@ -0,0 +1,183 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace Engine3
+{
+	/// A resizable array that stores its first \p InlineCapacity elements inside itself, and only allocates once it
+	/// grows past that. \n
+	/// For the many small lists that almost always hold a handful of elements, where std::vector would make every one
+	/// of them a separate heap allocation and an indirection to reach it.
+	/// @tparam T The type of each element.
+	/// @tparam InlineCapacity The number of elements stored without allocating.
+	template <class T, std::size_t InlineCapacity>
+		requires (InlineCapacity > 0)
+	class InlineVector
+	{
+	private:
+		alignas(T) std::byte InlineStorage[InlineCapacity * sizeof(T)];
+
+		T* Elements = reinterpret_cast<T*>(InlineStorage);
+
+		std::size_t Count = 0;
+
+		std::size_t MaximumCount = InlineCapacity;
+
+		bool IsInline() const { return Elements == reinterpret_cast<const T*>(InlineStorage); }
+
+		void Deallocate()
+		{
+			if (!IsInline()) { std::allocator<T>{}.deallocate(Elements, MaximumCount); }
+
+			Elements = reinterpret_cast<T*>(InlineStorage);
+			MaximumCount = InlineCapacity;
+		}
+
+		// Moves every element to uninitialised memory with room for them, leaving them destroyed here.
+		void MoveElementsTo(T* destination)
+		{
+			std::uninitialized_move(Elements, Elements + Count, destination);
+			std::destroy(Elements, Elements + Count);
+		}
+
+		void TakeFrom(InlineVector& rhs) noexcept(std::is_nothrow_move_constructible_v<T>)
+		{
+			if (rhs.IsInline()) { rhs.MoveElementsTo(Elements); }
+			else
+			{
+				// A heap allocation can just change hands.
+				Elements = std::exchange(rhs.Elements, reinterpret_cast<T*>(rhs.InlineStorage));
+				MaximumCount = std::exchange(rhs.MaximumCount, InlineCapacity);
+			}
+
+			Count = std::exchange(rhs.Count, 0);
+		}
+
+	public:
+		/* Constructors */
+		InlineVector() = default;
+
+		InlineVector(const InlineVector& rhs) requires std::copy_constructible<T>
+		{
+			Reserve(rhs.Count);
+			std::uninitialized_copy(rhs.begin(), rhs.end(), Elements);
+			Count = rhs.Count;
+		}
+
+		InlineVector(InlineVector&& rhs) noexcept(std::is_nothrow_move_constructible_v<T>) { TakeFrom(rhs); }
+
+		InlineVector& operator=(const InlineVector& rhs) requires std::copy_constructible<T>
+		{
+			if (this != &rhs)
+			{
+				Clear();
+				Reserve(rhs.Count);
+				std::uninitialized_copy(rhs.begin(), rhs.end(), Elements);
+				Count = rhs.Count;
+			}
+
+			return *this;
+		}
+
+		InlineVector& operator=(InlineVector&& rhs) noexcept(std::is_nothrow_move_constructible_v<T>)
+		{
+			if (this != &rhs)
+			{
+				Clear();
+				Deallocate();
+				TakeFrom(rhs);
+			}
+
+			return *this;
+		}
+
+		~InlineVector()
+		{
+			Clear();
+			Deallocate();
+		}
+
+		/* Capacity */
+		std::size_t Size() const { return Count; }
+
+		std::size_t Capacity() const { return MaximumCount; }
+
+		bool IsEmpty() const { return Count == 0; }
+
+		void Reserve(std::size_t capacity)
+		{
+			if (capacity <= MaximumCount) { return; }
+
+			T* allocation = std::allocator<T>{}.allocate(capacity);
+			MoveElementsTo(allocation);
+			Deallocate();
+
+			Elements = allocation;
+			MaximumCount = capacity;
+		}
+
+		/// Destroys every element, but keeps any allocation for reuse.
+		void Clear()
+		{
+			std::destroy(Elements, Elements + Count);
+			Count = 0;
+		}
+
+		/* Modifiers */
+		template <class... Args>
+		T& EmplaceBack(Args&&... args)
+		{
+			if (Count < MaximumCount)
+			{
+				T* element = std::construct_at(Elements + Count, std::forward<Args>(args)...);
+				++Count;
+				return *element;
+			}
+
+			// Constructed before the elements are moved, as the arguments could refer to one of them.
+			const std::size_t capacity = MaximumCount * 2;
+			T* allocation = std::allocator<T>{}.allocate(capacity);
+			T* element = std::construct_at(allocation + Count, std::forward<Args>(args)...);
+			MoveElementsTo(allocation);
+			Deallocate();
+
+			Elements = allocation;
+			MaximumCount = capacity;
+			++Count;
+
+			return *element;
+		}
+
+		T& PushBack(const T& value) { return EmplaceBack(value); }
+
+		T& PushBack(T&& value) { return EmplaceBack(std::move(value)); }
+
+		/* Element Access */
+		T& operator[](std::size_t index)
+		{
+			assert(index < Count);
+			return Elements[index];
+		}
+
+		const T& operator[](std::size_t index) const
+		{
+			assert(index < Count);
+			return Elements[index];
+		}
+
+		T* data() { return Elements; }
+		const T* data() const { return Elements; }
+
+		/* Iterators */
+		// Lowercase so that range-based for loops and the standard algorithms can use them.
+		T* begin() { return Elements; }
+		const T* begin() const { return Elements; }
+		T* end() { return Elements + Count; }
+		const T* end() const { return Elements + Count; }
+	};
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace Engine3
+{
+	/// Sorts \p elements by the 64 bit key \p key returns for each, a byte at a time from the least significant, keeping
+	/// elements with equal keys in the order they were in. \n
+	/// Linear in the number of elements, unlike a comparison sort, and a byte that's the same in every key is skipped
+	/// without moving anything, so keys whose high bits rarely differ take few passes.
+	/// @param scratch At least as large as \p elements, which elements are moved back and forth through.
+	/// @param key Called several times for each element, so should be cheap, e.g. returning a member.
+	template <class T, class Key>
+		requires std::convertible_to<std::invoke_result_t<Key&, const T&>, std::uint64_t>
+	void RadixSort(std::span<T> elements, std::span<T> scratch, Key key)
+	{
+		assert(scratch.size() >= elements.size());
+		if (elements.size() < 2) { return; }
+
+		constexpr std::size_t passes = sizeof(std::uint64_t);
+		constexpr std::size_t buckets = 256;
+
+		// Every pass's histogram is counted in one read of the keys, rather than one read per pass.
+		std::array<std::array<std::size_t, buckets>, passes> counts{};
+		for (const T& element : elements)
+		{
+			const std::uint64_t value = key(element);
+			for (std::size_t pass = 0; pass < passes; ++pass) { ++counts[pass][value >> (8 * pass) & 0xFF]; }
+		}
+
+		std::span<T> from = elements;
+		std::span<T> to = scratch.first(elements.size());
+		for (std::size_t pass = 0; pass < passes; ++pass)
+		{
+			std::array<std::size_t, buckets>& offsets = counts[pass];
+			const std::size_t shift = 8 * pass;
+			if (offsets[key(from.front()) >> shift & 0xFF] == elements.size()) { continue; }
+
+			std::size_t offset = 0;
+			for (std::size_t& bucket : offsets) { offset += std::exchange(bucket, offset); }
+
+			for (T& element : from) { to[offsets[key(element) >> shift & 0xFF]++] = std::move(element); }
+			std::swap(from, to);
+		}
+
+		if (from.data() != elements.data())
+		{
+			for (std::size_t i = 0; i < elements.size(); ++i) { elements[i] = std::move(from[i]); }
+		}
+	}
+}
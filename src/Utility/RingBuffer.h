@@ -0,0 +1,97 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+
+namespace Engine3
+{
+	/// A fixed size queue for passing elements from one thread to another without locking. \n
+	/// Exactly one thread may push and exactly one other thread may pop, each only ever writing its own index, so they
+	/// never wait on each other. When it's full pushing fails rather than blocking, so the producer decides what to do.
+	/// @tparam T The type of each element, copied in and out.
+	/// @tparam Capacity The most elements held at once, a power of two so indices wrap with a mask.
+	template <class T, std::size_t Capacity>
+		requires (std::has_single_bit(Capacity) && std::is_trivially_copyable_v<T>)
+	class RingBuffer
+	{
+	private:
+		static constexpr std::size_t Mask = Capacity - 1;
+
+		std::array<T, Capacity> Elements;
+
+		// What each thread writes is on its own cache line, so the producer and consumer don't contend through false
+		// sharing. The indices only ever increase, wrapping into the array with the mask, so full and empty can be told
+		// apart.
+
+		// Written by the consumer, with its last view of Tail so it only reads the producer's line once it looks empty.
+		alignas(64) std::atomic<std::size_t> Head = 0;
+		std::size_t CachedTail = 0;
+
+		// Written by the producer, with its last view of Head so it only reads the consumer's line once it looks full.
+		alignas(64) std::atomic<std::size_t> Tail = 0;
+		std::size_t CachedHead = 0;
+
+	public:
+		/* Capacity */
+		static constexpr std::size_t GetCapacity() { return Capacity; }
+
+		/// Only exact when neither thread is using it, otherwise it's a snapshot that may already be out of date.
+		std::size_t Size() const
+		{
+			return Tail.load(std::memory_order_acquire) - Head.load(std::memory_order_acquire);
+		}
+
+		bool IsEmpty() const { return Size() == 0; }
+
+		/* Producer */
+		/// Only call from the producing thread.
+		/// @return False, leaving the buffer unchanged, if it's full.
+		bool TryPush(const T& value)
+		{
+			const std::size_t tail = Tail.load(std::memory_order_relaxed);
+			if (tail - CachedHead == Capacity)
+			{
+				CachedHead = Head.load(std::memory_order_acquire);
+				if (tail - CachedHead == Capacity) { return false; }
+			}
+
+			Elements[tail & Mask] = value;
+			Tail.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		/* Consumer */
+		/// Only call from the consuming thread.
+		/// @return False, leaving \p value unchanged, if it's empty.
+		bool TryPop(T& value)
+		{
+			const std::size_t head = Head.load(std::memory_order_relaxed);
+			if (head == CachedTail)
+			{
+				CachedTail = Tail.load(std::memory_order_acquire);
+				if (head == CachedTail) { return false; }
+			}
+
+			value = Elements[head & Mask];
+			Head.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+		/// Only call from the consuming thread.
+		/// @return The oldest element without removing it, or nothing if it's empty.
+		std::optional<T> Peek()
+		{
+			const std::size_t head = Head.load(std::memory_order_relaxed);
+			if (head == CachedTail)
+			{
+				CachedTail = Tail.load(std::memory_order_acquire);
+				if (head == CachedTail) { return std::nullopt; }
+			}
+
+			return Elements[head & Mask];
+		}
+	};
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Engine3
+{
+	/// The most bytes a 64 bit integer takes as a varint.
+	constexpr std::size_t MaximumVarintSize = 10;
+
+	/// Appends \p value as an unsigned LEB128 varint, seven bits to a byte with the top bit set on all but the last,
+	/// so small values take a single byte.
+	inline void WriteVarint(std::uint64_t value, std::vector<std::uint8_t>& out)
+	{
+		while (value >= 0x80)
+		{
+			out.push_back(static_cast<std::uint8_t>(value | 0x80));
+			value >>= 7;
+		}
+
+		out.push_back(static_cast<std::uint8_t>(value));
+	}
+
+	/// Reads a varint written by WriteVarint from the front of \p in, advancing it past the varint.
+	/// @return False, leaving \p in unchanged, if \p in ends before the varint does or it's too long for 64 bits.
+	inline bool ReadVarint(std::span<const std::uint8_t>& in, std::uint64_t& value)
+	{
+		std::uint64_t result = 0;
+		for (std::size_t i = 0; i < in.size() && i < MaximumVarintSize; ++i)
+		{
+			result |= static_cast<std::uint64_t>(in[i] & 0x7F) << (7 * i);
+			if ((in[i] & 0x80) == 0)
+			{
+				// The tenth byte only has room for the top bit.
+				if (i == MaximumVarintSize - 1 && in[i] > 1) { return false; }
+
+				value = result;
+				in = in.subspan(i + 1);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	/// Maps signed integers to unsigned so those near zero stay small as varints, 0, -1, 1, -2... to 0, 1, 2, 3...
+	constexpr std::uint64_t ZigZagEncode(std::int64_t value)
+	{
+		return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+	}
+
+	constexpr std::int64_t ZigZagDecode(std::uint64_t value)
+	{
+		return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+	}
+}
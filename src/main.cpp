@@ -5,8 +5,6 @@
 #include "Core/Window.h"
 #include "Input/InputManager.h"
 #include "Input/Conditions/PressedCondition.h"
-#include "Input/Modifiers/DeadZoneModifier.h"
-#include "Input/Modifiers/SwizzleModifier.h"
 #include "Utility/BitFlags.h"
 
 using namespace Engine3;
@@ -104,14 +102,18 @@ int main(int argc, char* argv[])
 	Action& mousePos = inputManager.AddAction(printVector2);
 	mousePos.AddInput(Input::Mouse::Left).AddCondition<PressedCondition>();
 
-	Action& leftAxis = inputManager.AddAction(printVector2);
-	leftAxis.AddInput(Input::GamepadAxis::LeftX).AddModifier<DeadZoneModifier>();
-	leftAxis.AddInput(Input::GamepadAxis::LeftY).AddModifier<DeadZoneModifier>().AddModifier<SwizzleModifier>();
+	// Both axes together, so Events' radial dead zone sees the stick as a whole rather than each axis on its own.
+	Action& leftStick = inputManager.AddAction(printVector2);
+	leftStick.AddInput(Input::GamepadStick::Left);
 
 	Events events;
-	while (events.Process(window, renderer, inputManager))
+	events.SetResizeCallback([&renderer](int width, int height) { renderer.SetSize(width, height); });
+	const Matrix<4> offset = Matrix<4>::Translation(0.f, 0.f, -1.f);
+	while (events.Process(inputManager))
 	{
 		engine.Update();
+		renderer.Submit(Renderer::FirstObject, Renderer::DefaultMaterial, offset);
+		renderer.Submit(Renderer::SecondObject, Renderer::DefaultMaterial, offset);
 		renderer.Render();
 	}
 
@@ -0,0 +1,107 @@
+#include "../../src/Core/ControllerRegistry.h"
+#include <map>
+#include <random>
+#include <gtest/gtest.h>
+
+namespace Engine3
+{
+	namespace
+	{
+		// Never dereferenced, so any distinct pointer will do.
+		SDL_GameController* FakeController(std::int32_t instanceID)
+		{
+			return reinterpret_cast<SDL_GameController*>(static_cast<std::uintptr_t>(instanceID + 1) * 16);
+		}
+	}
+
+	TEST(ControllerRegistry, AddAndRemove)
+	{
+		ControllerRegistry registry;
+		EXPECT_FALSE(registry.Contains(3));
+		EXPECT_EQ(registry.GetPlayer(3), ControllerRegistry::NoPlayer);
+		EXPECT_EQ(registry.Get(3), nullptr);
+
+		EXPECT_EQ(registry.Add(3, FakeController(3)), 0);
+		EXPECT_TRUE(registry.Contains(3));
+		EXPECT_EQ(registry.Get(3), FakeController(3));
+		EXPECT_EQ(registry.Size(), 1);
+
+		// Adding it again keeps its player.
+		EXPECT_EQ(registry.Add(3, FakeController(3)), 0);
+		EXPECT_EQ(registry.Size(), 1);
+
+		EXPECT_EQ(registry.Remove(3), FakeController(3));
+		EXPECT_FALSE(registry.Contains(3));
+		EXPECT_EQ(registry.Remove(3), nullptr);
+		EXPECT_EQ(registry.Size(), 0);
+
+		// Input that isn't from a controller is never registered.
+		EXPECT_FALSE(registry.Contains(-1));
+	}
+
+	TEST(ControllerRegistry, LowestFreePlayer)
+	{
+		ControllerRegistry registry;
+		for (std::int32_t instanceID = 10; instanceID < 14; ++instanceID)
+		{
+			EXPECT_EQ(registry.Add(instanceID, FakeController(instanceID)), instanceID - 10);
+		}
+
+		// A reconnected controller takes the first free player, not a new one.
+		registry.Remove(11);
+		EXPECT_EQ(registry.Add(20, FakeController(20)), 1);
+		EXPECT_EQ(registry.GetPlayer(12), 2);
+	}
+
+	TEST(ControllerRegistry, RunsOutOfPlayers)
+	{
+		ControllerRegistry registry;
+		for (std::int32_t instanceID = 0; instanceID < ControllerRegistry::MaximumPlayers; ++instanceID)
+		{
+			ASSERT_EQ(registry.Add(instanceID, FakeController(instanceID)), instanceID);
+		}
+
+		EXPECT_EQ(registry.Add(1000, FakeController(1000)), ControllerRegistry::NoPlayer);
+		EXPECT_TRUE(registry.Contains(1000));
+	}
+
+	TEST(ControllerRegistry, MatchesAMap)
+	{
+		// Lots of connecting and disconnecting, which moves entries around as it grows and as entries are removed.
+		ControllerRegistry registry;
+		std::map<std::int32_t, SDL_GameController*> expected;
+		std::mt19937 generator{7};
+		std::uniform_int_distribution<std::int32_t> instanceIDs{0, 200};
+		std::bernoulli_distribution isAdd{0.6};
+
+		for (int i = 0; i < 10'000; ++i)
+		{
+			const std::int32_t instanceID = instanceIDs(generator);
+			if (isAdd(generator))
+			{
+				registry.Add(instanceID, FakeController(instanceID));
+				expected.emplace(instanceID, FakeController(instanceID));
+			}
+			else
+			{
+				const auto found = expected.find(instanceID);
+				ASSERT_EQ(registry.Remove(instanceID), found == expected.end() ? nullptr : found->second);
+				if (found != expected.end()) { expected.erase(found); }
+			}
+		}
+
+		ASSERT_EQ(registry.Size(), expected.size());
+		for (std::int32_t instanceID = 0; instanceID <= 200; ++instanceID)
+		{
+			EXPECT_EQ(registry.Contains(instanceID), expected.contains(instanceID));
+		}
+
+		std::size_t visited = 0;
+		registry.ForEach([&](std::int32_t instanceID, std::int32_t, SDL_GameController* controller)
+		{
+			EXPECT_EQ(controller, expected.at(instanceID));
+			++visited;
+		});
+		EXPECT_EQ(visited, expected.size());
+	}
+}
@@ -0,0 +1,210 @@
+#define SDL_MAIN_HANDLED
+#include "../../src/Core/Events.h"
+#include "../../src/Input/InputManager.h"
+#include "../../src/Input/InputRecord.h"
+#include "../../src/Input/Conditions/PressedCondition.h"
+#include <SDL.h>
+#include <gtest/gtest.h>
+
+namespace Engine3
+{
+	namespace
+	{
+		// Runs without a display, so SDL's event queue can be driven entirely by pushing events.
+		class EventsTest : public testing::Test
+		{
+		protected:
+			void SetUp() override
+			{
+				SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+				ASSERT_EQ(SDL_Init(SDL_INIT_VIDEO | SDL_INIT_EVENTS), 0) << SDL_GetError();
+			}
+
+			void TearDown() override { SDL_Quit(); }
+		};
+
+		void PushMouseMotion(int xrel, int yrel)
+		{
+			SDL_Event event{};
+			event.type = SDL_MOUSEMOTION;
+			event.motion.xrel = xrel;
+			event.motion.yrel = yrel;
+			ASSERT_EQ(SDL_PushEvent(&event), 1) << SDL_GetError();
+		}
+
+		void PushMouseButton(Uint32 type)
+		{
+			SDL_Event event{};
+			event.type = type;
+			event.button.button = SDL_BUTTON_LEFT;
+			ASSERT_EQ(SDL_PushEvent(&event), 1) << SDL_GetError();
+		}
+
+		void PushKey(Uint32 type, SDL_Scancode scancode)
+		{
+			SDL_Event event{};
+			event.type = type;
+			event.key.keysym.scancode = scancode;
+			ASSERT_EQ(SDL_PushEvent(&event), 1) << SDL_GetError();
+		}
+	}
+
+	TEST_F(EventsTest, FramesToDispatchAfterBurst)
+	{
+		// A high polling rate mouse can queue hundreds of motion events between frames, polling one event per frame
+		// would leave the click behind all of them.
+		InputManager inputManager;
+		int dispatched = 0;
+		inputManager.AddAction(std::function([&dispatched] { ++dispatched; }))
+		            .AddInput(Input::Mouse::Left).AddCondition<PressedCondition>();
+
+		for (int i = 0; i < 1000; ++i) { PushMouseMotion(1, 0); }
+		PushMouseButton(SDL_MOUSEBUTTONDOWN);
+
+		Events events;
+		int frames = 0;
+		while (dispatched == 0 && frames < 10)
+		{
+			ASSERT_TRUE(events.Process(inputManager));
+			++frames;
+		}
+
+		EXPECT_EQ(frames, 1);
+	}
+
+	TEST_F(EventsTest, ClicksWithinAFrameArePressed)
+	{
+		// The releases arrive before the presses are processed, which mustn't hide them, nor process anything twice.
+		InputManager inputManager;
+		int presses = 0;
+		int moves = 0;
+		inputManager.AddAction(std::function([&presses] { ++presses; }))
+		            .AddInput(Input::Mouse::Left).AddCondition<PressedCondition>();
+		inputManager.AddAction(std::function([&moves] { ++moves; })).AddInput(Input::Key::W);
+
+		PushKey(SDL_KEYDOWN, SDL_SCANCODE_W);
+		for (int i = 0; i < 2; ++i)
+		{
+			PushMouseButton(SDL_MOUSEBUTTONDOWN);
+			PushMouseButton(SDL_MOUSEBUTTONUP);
+		}
+
+		Events events;
+		ASSERT_TRUE(events.Process(inputManager));
+		EXPECT_EQ(presses, 1);
+		EXPECT_EQ(moves, 1);
+
+		ASSERT_TRUE(events.Process(inputManager));
+		EXPECT_EQ(presses, 1);
+		EXPECT_EQ(moves, 2);
+	}
+
+	TEST_F(EventsTest, MouseMotionIsCoalesced)
+	{
+		InputManager inputManager;
+		std::vector<float> received;
+		inputManager.AddAction(std::function([&received](float value) { received.push_back(value); }))
+		            .AddInput(Input::Mouse::MouseAxisX);
+
+		// More than one batch, so the queue has to be drained in several.
+		const int count = static_cast<int>(Events::BatchSize) * 3 + 5;
+		for (int i = 0; i < count; ++i) { PushMouseMotion(2, -1); }
+
+		Events events;
+		ASSERT_TRUE(events.Process(inputManager));
+
+		ASSERT_EQ(received.size(), 1);
+		EXPECT_EQ(received[0], static_cast<float>(count * 2));
+
+		// Relative motion is consumed, so it isn't dispatched again without new events.
+		ASSERT_TRUE(events.Process(inputManager));
+		EXPECT_EQ(received.size(), 1);
+	}
+
+	TEST_F(EventsTest, QuitStillHandlesRemainingEvents)
+	{
+		InputManager inputManager;
+		float total = 0;
+		inputManager.AddAction(std::function([&total](float value) { total += value; }))
+		            .AddInput(Input::Mouse::MouseAxisX);
+
+		SDL_Event quit{};
+		quit.type = SDL_QUIT;
+		ASSERT_EQ(SDL_PushEvent(&quit), 1) << SDL_GetError();
+		PushMouseMotion(3, 0);
+
+		Events events;
+		EXPECT_FALSE(events.Process(inputManager));
+		EXPECT_EQ(total, 3.f);
+	}
+
+	TEST(Events, SticksArePaired)
+	{
+		// Replayed, as controllers can't be connected under the dummy driver.
+		InputManager inputManager;
+		std::vector<Vector<2>> received;
+		int axisUpdates = 0;
+		inputManager.AddAction(std::function([&received](Vector<2> value) { received.push_back(value); }))
+		            .AddInput(Input::GamepadStick::Left);
+		inputManager.AddAction(std::function([&axisUpdates](float) { ++axisUpdates; }))
+		            .AddInput(Input::GamepadAxis::RightX);
+
+		Events events;
+		events.SetStickDeadZone({DeadZoneShape::Radial, 0.2f});
+
+		auto axis = [](SDL_GameControllerAxis axis, float value, std::int32_t controller)
+		{
+			return InputRecord{{}, axis, ProcessState::Continuous, value, controller};
+		};
+
+		// Each axis is inside the dead zone, but the stick isn't, which it would be if they were seen apart.
+		const std::vector<InputRecord> frame{
+			axis(SDL_CONTROLLER_AXIS_LEFTX, 0.1f, 0), axis(SDL_CONTROLLER_AXIS_LEFTY, 0.1f, 0),
+			axis(SDL_CONTROLLER_AXIS_LEFTX, 0.15f, 0), axis(SDL_CONTROLLER_AXIS_LEFTY, 0.15f, 0),
+			axis(SDL_CONTROLLER_AXIS_RIGHTX, 0.5f, 0),
+		};
+		events.Replay(inputManager, frame);
+
+		ASSERT_EQ(received.size(), 1);
+		EXPECT_EQ(received[0], (Vector<2>{0.15f, 0.15f}));
+		EXPECT_EQ(axisUpdates, 1);
+
+		// Only X moves, so the stick keeps its last Y.
+		events.Replay(inputManager, std::vector{axis(SDL_CONTROLLER_AXIS_LEFTX, 0.3f, 0)});
+		ASSERT_EQ(received.size(), 2);
+		EXPECT_EQ(received[1], (Vector<2>{0.3f, 0.15f}));
+
+		// A stick within the dead zone is zero.
+		events.Replay(inputManager,
+		              std::vector{axis(SDL_CONTROLLER_AXIS_LEFTX, 0.1f, 0), axis(SDL_CONTROLLER_AXIS_LEFTY, 0.f, 0)});
+		ASSERT_EQ(received.size(), 3);
+		EXPECT_EQ(received[2], (Vector<2>{0.f, 0.f}));
+	}
+
+	TEST(Events, SticksKeepTheirPlayer)
+	{
+		InputManager inputManager;
+		std::vector<std::vector<Vector<2>>> received(2);
+		for (std::int32_t player = 0; player < 2; ++player)
+		{
+			inputManager.AddAction(std::function([&received, player](Vector<2> value)
+			            {
+				            received[player].push_back(value);
+			            }))
+			            .AddInput(Input::GamepadStick::Left, player);
+		}
+
+		Events events;
+		events.SetStickDeadZone({DeadZoneShape::Radial, 0.f});
+
+		// As recorded, with the player each controller had.
+		const std::vector<InputRecord> frame{
+			{{}, SDL_CONTROLLER_AXIS_LEFTX, ProcessState::Continuous, 0.5f, 7, 1},
+			{{}, SDL_CONTROLLER_AXIS_LEFTY, ProcessState::Continuous, -0.5f, 9, 0},
+		};
+		events.Replay(inputManager, frame);
+
+		EXPECT_EQ(received[0], (std::vector{Vector<2>{0.f, -0.5f}}));
+		EXPECT_EQ(received[1], (std::vector{Vector<2>{0.5f, 0.f}}));
+	}
+}
@@ -0,0 +1,91 @@
+#include "../../src/Core/FrameClock.h"
+#include <gtest/gtest.h>
+using namespace std::chrono_literals;
+
+namespace Engine3
+{
+	TEST(FrameClock, StepsMatchElapsedTime)
+	{
+		FrameClock clock{10ms};
+		clock.Advance(35ms);
+
+		int steps = 0;
+		while (clock.ConsumeStep()) { ++steps; }
+
+		EXPECT_EQ(steps, 3);
+		EXPECT_FLOAT_EQ(clock.GetInterpolation(), 0.5f);
+	}
+
+	TEST(FrameClock, RemainderCarriesOver)
+	{
+		FrameClock clock{10ms};
+
+		clock.Advance(6ms);
+		EXPECT_FALSE(clock.ConsumeStep());
+
+		clock.Advance(6ms);
+		EXPECT_TRUE(clock.ConsumeStep());
+		EXPECT_FALSE(clock.ConsumeStep());
+		EXPECT_FLOAT_EQ(clock.GetInterpolation(), 0.2f);
+	}
+
+	TEST(FrameClock, LongFramesAreClamped)
+	{
+		FrameClock clock{10ms};
+		clock.SetMaximumFrameTime(50ms);
+		clock.Advance(2s);
+
+		int steps = 0;
+		while (clock.ConsumeStep()) { ++steps; }
+
+		EXPECT_EQ(steps, 5);
+		EXPECT_FLOAT_EQ(clock.GetDeltaTime(), 2.f);
+	}
+
+	TEST(FrameClock, FixedDeltaTime)
+	{
+		const FrameClock clock{20ms};
+
+		EXPECT_FLOAT_EQ(clock.GetFixedDeltaTime(), 0.02f);
+	}
+
+	TEST(FrameClock, StatsBeforeFirstFrame)
+	{
+		const FrameClock::Stats stats = FrameClock{}.GetStats();
+
+		EXPECT_EQ(stats.Maximum, FrameClock::Duration::zero());
+	}
+
+	TEST(FrameClock, Stats)
+	{
+		// Every frame takes 10ms except for a few slow ones, which only show in the tail.
+		FrameClock clock;
+		for (int i = 0; i < 200; ++i) { clock.Advance(i % 70 == 0 ? 40ms : 10ms); }
+		clock.Advance(5ms);
+
+		const FrameClock::Stats stats = clock.GetStats();
+		EXPECT_EQ(stats.Minimum, 5ms);
+		EXPECT_EQ(stats.Maximum, 40ms);
+		EXPECT_EQ(stats.Percentile99, 40ms);
+		EXPECT_EQ(stats.Average, std::chrono::nanoseconds{197 * 10ms + 3 * 40ms + 5ms} / 201);
+	}
+
+	TEST(FrameClock, StatsOnlyCoverRecentFrames)
+	{
+		FrameClock clock;
+		clock.Advance(100ms);
+		for (std::size_t i = 0; i < FrameClock::HistorySize; ++i) { clock.Advance(10ms); }
+
+		EXPECT_EQ(clock.GetStats().Maximum, 10ms);
+	}
+
+	TEST(FrameClock, TargetFrameTimePacesTick)
+	{
+		FrameClock clock;
+		clock.SetTargetFrameTime(5ms);
+		clock.Tick();
+		clock.Tick();
+
+		EXPECT_GE(clock.GetFrameTime(), 5ms);
+	}
+}
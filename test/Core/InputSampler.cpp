@@ -0,0 +1,176 @@
+#define SDL_MAIN_HANDLED
+#include "../../src/Core/Events.h"
+#include "../../src/Core/InputSampler.h"
+#include "../../src/Input/InputManager.h"
+#include "../../src/Input/Conditions/PressedCondition.h"
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <SDL.h>
+#include <gtest/gtest.h>
+
+namespace Engine3
+{
+	namespace
+	{
+		// Runs without a display, so SDL's event queue can be driven entirely by pushing events.
+		class InputSamplerTest : public testing::Test
+		{
+		protected:
+			void SetUp() override
+			{
+				SDL_SetHint(SDL_HINT_VIDEODRIVER, "dummy");
+				ASSERT_EQ(SDL_Init(SDL_INIT_VIDEO | SDL_INIT_EVENTS), 0) << SDL_GetError();
+			}
+
+			void TearDown() override { SDL_Quit(); }
+		};
+
+		void PushKey(Uint32 type, SDL_Scancode scancode)
+		{
+			SDL_Event event{};
+			event.type = type;
+			event.key.keysym.scancode = scancode;
+			ASSERT_EQ(SDL_PushEvent(&event), 1) << SDL_GetError();
+		}
+
+		// The sampler runs on its own, so wait for it rather than assume it's been scheduled.
+		bool WaitForRecord(InputSampler& inputSampler, InputRecord& record)
+		{
+			const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+			while (std::chrono::steady_clock::now() < timeout)
+			{
+				if (inputSampler.TryPop(record)) { return true; }
+				std::this_thread::yield();
+			}
+
+			return false;
+		}
+	}
+
+	TEST_F(InputSamplerTest, RecordsAreTimestampedWhenQueued)
+	{
+		// SDL's ticks are whole milliseconds, so a timestamp can be up to one either side of when it was really queued.
+		constexpr std::chrono::milliseconds tick{1};
+
+		InputSampler inputSampler{InputSampler::Pumping::SamplingThread};
+
+		const auto beforeFirst = InputRecord::Clock::now();
+		PushKey(SDL_KEYDOWN, SDL_SCANCODE_A);
+		InputRecord first;
+		ASSERT_TRUE(WaitForRecord(inputSampler, first));
+
+		// Pushed well after the first was sampled, so it must be stamped later, without waiting for a frame.
+		std::this_thread::sleep_for(std::chrono::milliseconds{5});
+		const auto beforeSecond = InputRecord::Clock::now();
+		PushKey(SDL_KEYUP, SDL_SCANCODE_A);
+		InputRecord second;
+		ASSERT_TRUE(WaitForRecord(inputSampler, second));
+
+		EXPECT_EQ(first.Input, InternalInputType{SDL_SCANCODE_A});
+		EXPECT_EQ(first.State, ProcessState::Continuous);
+		EXPECT_GE(first.Timestamp, beforeFirst - tick);
+		EXPECT_LE(first.Timestamp, beforeSecond);
+
+		EXPECT_EQ(second.State, ProcessState::Release);
+		EXPECT_GE(second.Timestamp, beforeSecond - tick);
+	}
+
+	TEST_F(InputSamplerTest, MainThreadPumpingKeepsWhenInputWasQueued)
+	{
+		InputManager inputManager;
+		InputSampler inputSampler{InputSampler::Pumping::MainThread};
+		Events events;
+		std::vector<InputRecord> records;
+		events.SetInputCallback([&records](const InputRecord& record) { records.push_back(record); });
+
+		// Both are handled in the same frame, but were queued apart.
+		PushKey(SDL_KEYDOWN, SDL_SCANCODE_A);
+		std::this_thread::sleep_for(std::chrono::milliseconds{5});
+		PushKey(SDL_KEYUP, SDL_SCANCODE_A);
+		ASSERT_TRUE(events.Process(inputManager, inputSampler));
+
+		ASSERT_EQ(records.size(), 2);
+		EXPECT_GE(records[1].Timestamp - records[0].Timestamp, std::chrono::milliseconds{4});
+		EXPECT_LE(records[1].Timestamp, InputRecord::Clock::now() + std::chrono::milliseconds{1});
+	}
+
+	TEST_F(InputSamplerTest, PopUntilLeavesLaterRecords)
+	{
+		InputSampler inputSampler{InputSampler::Pumping::SamplingThread};
+		PushKey(SDL_KEYDOWN, SDL_SCANCODE_A);
+
+		InputRecord record;
+		const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+		while (inputSampler.TryPopUntil(InputRecord::Clock::time_point{}, record)) {}
+		while (!inputSampler.TryPopUntil(InputRecord::Clock::now(), record))
+		{
+			ASSERT_LT(std::chrono::steady_clock::now(), timeout);
+			std::this_thread::yield();
+		}
+
+		EXPECT_EQ(record.Input, InternalInputType{SDL_SCANCODE_A});
+	}
+
+	TEST_F(InputSamplerTest, EventsProcessesSampledInput)
+	{
+		InputManager inputManager;
+		std::vector<float> received;
+		inputManager.AddAction(std::function([&received](float value) { received.push_back(value); }))
+		            .AddInput(Input::Mouse::MouseAxisX);
+
+		std::vector<InputRecord> records;
+		Events events;
+		events.SetInputCallback([&records](const InputRecord& record) { records.push_back(record); });
+
+		InputSampler inputSampler{InputSampler::Pumping::SamplingThread};
+		for (int i = 0; i < 10; ++i)
+		{
+			SDL_Event event{};
+			event.type = SDL_MOUSEMOTION;
+			event.motion.xrel = 1;
+			ASSERT_EQ(SDL_PushEvent(&event), 1) << SDL_GetError();
+		}
+		SDL_Event quit{};
+		quit.type = SDL_QUIT;
+		ASSERT_EQ(SDL_PushEvent(&quit), 1) << SDL_GetError();
+
+		// Keep processing frames until the sampler has passed everything on, which ends with the quit.
+		const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+		float total = 0;
+		while (events.Process(inputManager, inputSampler))
+		{
+			ASSERT_LT(std::chrono::steady_clock::now(), timeout);
+			std::this_thread::yield();
+		}
+		for (float value : received) { total += value; }
+
+		// Both axes of every motion event, each seen with its own timestamp before being coalesced.
+		EXPECT_EQ(records.size(), 20);
+		EXPECT_EQ(total, 10.f);
+	}
+
+	TEST_F(InputSamplerTest, MainThreadPumpingHandlesInputTheSameFrame)
+	{
+		EXPECT_EQ(InputSampler::DefaultPumping(), InputSampler::Pumping::MainThread);
+
+		InputManager inputManager;
+		int presses = 0;
+		inputManager.AddAction(std::function([&presses] { ++presses; }))
+		            .AddInput(Input::Key::A)
+		            .AddCondition<PressedCondition>();
+
+		InputSampler inputSampler{InputSampler::Pumping::MainThread};
+		Events events;
+
+		// Nothing else takes from SDL's queue, so the press is handled by the frame it's pumped in, without waiting.
+		PushKey(SDL_KEYDOWN, SDL_SCANCODE_A);
+		ASSERT_TRUE(events.Process(inputManager, inputSampler));
+		EXPECT_EQ(presses, 1);
+
+		PushKey(SDL_KEYUP, SDL_SCANCODE_A);
+		PushKey(SDL_KEYDOWN, SDL_SCANCODE_A);
+		ASSERT_TRUE(events.Process(inputManager, inputSampler));
+		EXPECT_EQ(presses, 2);
+	}
+}
@@ -0,0 +1,171 @@
+#include "../../src/Input/BindingProfile.h"
+#include "../../src/Input/InputManager.h"
+#include "../../src/Input/Conditions/PressedCondition.h"
+#include <sstream>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+namespace Engine3
+{
+	namespace
+	{
+		// On foot, jumping is space and driving does nothing. In a vehicle, driving is space.
+		struct Controls
+		{
+			InputManager Manager;
+			std::vector<std::string> Calls;
+			Action* Jump;
+			Action* Drive;
+
+			Controls()
+			{
+				Jump = &Manager.AddAction(std::function([this] { Calls.emplace_back("Jump"); }));
+				Jump->AddInput(Input::Key::Space);
+				Drive = &Manager.AddAction(std::function([this](float) { Calls.emplace_back("Drive"); }));
+				Drive->AddInput(Input::Key::W);
+			}
+		};
+
+		BindingProfile Vehicle(const Controls& controls)
+		{
+			BindingProfile profile{"Vehicle"};
+			profile.Rebind(*controls.Jump, 0, SDL_SCANCODE_J);
+			profile.Rebind(*controls.Drive, 0, SDL_SCANCODE_SPACE);
+			return profile;
+		}
+	}
+
+	TEST(BindingProfile, RebindingKeepsItSorted)
+	{
+		BindingProfile profile;
+		profile.Rebind(2, 0, SDL_SCANCODE_A);
+		profile.Rebind(0, 1, SDL_SCANCODE_B);
+		profile.Rebind(0, 0, SDL_SCANCODE_C);
+		profile.Rebind(0, 1, SDL_SCANCODE_D, 1);
+		profile.Reset(2, 0);
+
+		ASSERT_EQ(profile.GetRebindings().size(), 2);
+		EXPECT_EQ(profile.GetRebindings()[0].Type, InternalInputType{SDL_SCANCODE_C});
+		EXPECT_EQ(profile.GetRebindings()[1].Type, InternalInputType{SDL_SCANCODE_D});
+		EXPECT_EQ(profile.GetRebindings()[1].Player, 1);
+	}
+
+	TEST(BindingProfile, SwappedInAtTheEndOfProcess)
+	{
+		Controls controls;
+		controls.Manager.SetProfile(Vehicle(controls));
+
+		// Still on foot for the rest of the frame.
+		controls.Manager.Update(SDL_SCANCODE_SPACE, ProcessState::Once, {});
+		controls.Manager.Process();
+		EXPECT_EQ(controls.Calls, (std::vector<std::string>{"Jump"}));
+
+		controls.Manager.Update(SDL_SCANCODE_SPACE, ProcessState::Once, {});
+		controls.Manager.Update(SDL_SCANCODE_W, ProcessState::Once, {});
+		controls.Manager.Process();
+		EXPECT_EQ(controls.Calls, (std::vector<std::string>{"Jump", "Drive"}));
+
+		// Back on foot, with an empty profile.
+		controls.Manager.SetProfile(BindingProfile{});
+		controls.Manager.Process();
+		controls.Manager.Update(SDL_SCANCODE_W, ProcessState::Once, {});
+		controls.Manager.Update(SDL_SCANCODE_J, ProcessState::Once, {});
+		controls.Manager.Process();
+		EXPECT_EQ(controls.Calls, (std::vector<std::string>{"Jump", "Drive", "Drive"}));
+	}
+
+	TEST(BindingProfile, HeldInputsStopWhenSwapped)
+	{
+		Controls controls;
+		controls.Manager.Update(SDL_SCANCODE_W, ProcessState::Continuous, 1.f);
+		controls.Manager.Process();
+		controls.Manager.SetProfile(Vehicle(controls));
+		controls.Manager.Process();
+		EXPECT_EQ(controls.Calls, (std::vector<std::string>{"Drive", "Drive"}));
+
+		// W isn't bound any more, so its release would never reach it.
+		controls.Manager.Process();
+		EXPECT_EQ(controls.Calls.size(), 2);
+	}
+
+	TEST(BindingProfile, HeldPressIsForgottenWhenSwapped)
+	{
+		// Space is held when it's rebound to J, so its release never arrives, and J's press mustn't be seen as a hold.
+		InputManager manager;
+		int presses = 0;
+		Action& jump = manager.AddAction(std::function([&presses] { ++presses; }));
+		jump.AddInput(Input::Key::Space).AddCondition<PressedCondition>();
+
+		manager.Update(SDL_SCANCODE_SPACE, ProcessState::Continuous, {});
+		manager.Process();
+		EXPECT_EQ(presses, 1);
+
+		BindingProfile profile;
+		profile.Rebind(jump, 0, SDL_SCANCODE_J);
+		manager.SetProfile(profile);
+		manager.Process();
+
+		manager.Update(SDL_SCANCODE_J, ProcessState::Continuous, {});
+		manager.Process();
+		EXPECT_EQ(presses, 2);
+	}
+
+	TEST(BindingProfile, InputsAddedAfterwardsAreBound)
+	{
+		Controls controls;
+		controls.Manager.SetProfile(Vehicle(controls));
+		controls.Jump->AddInput(Input::Key::Return);
+		controls.Manager.Process();
+
+		controls.Manager.Update(SDL_SCANCODE_RETURN, ProcessState::Once, {});
+		controls.Manager.Process();
+		EXPECT_EQ(controls.Calls, (std::vector<std::string>{"Jump"}));
+	}
+
+	TEST(BindingProfile, SaveAndLoad)
+	{
+		BindingProfile profile{"Custom"};
+		profile.Rebind(0, 0, SDL_SCANCODE_Q);
+		profile.Rebind(0, 3, Input::Mouse::Right);
+		profile.Rebind(7, 1, SDL_CONTROLLER_BUTTON_Y, 2);
+		profile.Rebind(300, 0, Input::GamepadStick::Left, 0);
+
+		std::stringstream stream;
+		profile.Save(stream);
+
+		BindingProfile loaded;
+		ASSERT_TRUE(loaded.Load(stream));
+		EXPECT_EQ(loaded.Name, "Custom");
+		ASSERT_EQ(loaded.GetRebindings().size(), profile.GetRebindings().size());
+		for (std::size_t i = 0; i < profile.GetRebindings().size(); ++i)
+		{
+			const Rebinding& expected = profile.GetRebindings()[i];
+			const Rebinding& actual = loaded.GetRebindings()[i];
+			EXPECT_EQ(actual.ActionIndex, expected.ActionIndex);
+			EXPECT_EQ(actual.InputIndex, expected.InputIndex);
+			EXPECT_EQ(actual.Type, expected.Type);
+			EXPECT_EQ(actual.Player, expected.Player);
+		}
+	}
+
+	TEST(BindingProfile, LoadRejectsCorruptProfiles)
+	{
+		BindingProfile profile{"Custom"};
+		profile.Rebind(0, 0, SDL_SCANCODE_Q);
+		std::stringstream stream;
+		profile.Save(stream);
+		const std::string bytes = stream.str();
+
+		BindingProfile loaded{"Unchanged"};
+		std::istringstream truncated{bytes.substr(0, bytes.size() - 1)};
+		EXPECT_FALSE(loaded.Load(truncated));
+		std::istringstream extended{bytes + '\0'};
+		EXPECT_FALSE(loaded.Load(extended));
+		std::istringstream other{"E3IL\1"};
+		EXPECT_FALSE(loaded.Load(other));
+
+		EXPECT_EQ(loaded.Name, "Unchanged");
+		EXPECT_TRUE(loaded.GetRebindings().empty());
+	}
+}
@@ -0,0 +1,82 @@
+#include "../../src/Input/InputManager.h"
+#include <vector>
+#include <gtest/gtest.h>
+
+namespace Engine3
+{
+	namespace
+	{
+		constexpr BindingSet Bindings{
+			BindAction<>(Input::Key::Space, InputBinding{Input::GamepadButton::A, 1}.WithCondition<PressedCondition>()),
+			BindAction<float>(Input::Key::W, Input::Key::S).Cumulate(),
+			BindAction<Vector<2>>(InputBinding{Input::GamepadStick::Left}.WithModifier<DeadZoneModifier>(0.5f)
+			                                                              .WithModifier<SwizzleModifier>())
+		};
+
+		static_assert(Bindings.ActionCount == 3);
+		static_assert(Bindings.InputCount == 5);
+		static_assert(std::get<1>(Bindings.ActionBindings).CumulateInputs);
+		static_assert(std::get<2>(Bindings.ActionBindings).Inputs[0].ModifierCount == 2);
+		static_assert(BindAction<>(Input::Key::A, Input::Key::A).HasDuplicateInputs());
+		static_assert(!BindAction<>(InputBinding{Input::GamepadButton::A, 0}, Input::GamepadButton::A).HasDuplicateInputs());
+	}
+
+	TEST(BindingSet, AddsEachActionInOrder)
+	{
+		InputManager inputManager;
+		std::vector<int> calls;
+		const auto actions = inputManager.AddActions(
+			Bindings,
+			[&calls] { calls.push_back(0); },
+			[&calls](float) { calls.push_back(1); },
+			[&calls](Vector<2>) { calls.push_back(2); });
+
+		EXPECT_NE(actions[0], actions[1]);
+		EXPECT_NE(actions[1], actions[2]);
+
+		inputManager.Update(Input::GamepadStick::Left, ProcessState::Once, Vector<2>{1.f, 0.f});
+		inputManager.Update(SDL_SCANCODE_W, ProcessState::Once, 1.f);
+		inputManager.Update(SDL_SCANCODE_SPACE, ProcessState::Once, {});
+		inputManager.Process();
+
+		EXPECT_EQ(calls, (std::vector<int>{0, 1, 2}));
+	}
+
+	TEST(BindingSet, MaterialisesModifiersAndConditions)
+	{
+		InputManager inputManager;
+		int jumps = 0;
+		float moved = 0;
+		Vector<2> looked;
+		inputManager.AddActions(
+			Bindings,
+			[&jumps] { ++jumps; },
+			[&moved](float value) { moved = value; },
+			[&looked](Vector<2> value) { looked = value; });
+
+		// Only player one's controller is bound, and only the press is acted upon.
+		inputManager.Update(SDL_CONTROLLER_BUTTON_A, ProcessState::Once, {}, 0);
+		inputManager.Process();
+		EXPECT_EQ(jumps, 0);
+
+		inputManager.Update(SDL_CONTROLLER_BUTTON_A, ProcessState::Continuous, {}, 1);
+		inputManager.Process();
+		inputManager.Process();
+		EXPECT_EQ(jumps, 1);
+
+		// Cumulated, so both keys are summed.
+		inputManager.Update(SDL_SCANCODE_W, ProcessState::Once, 1.f);
+		inputManager.Update(SDL_SCANCODE_S, ProcessState::Once, -0.25f);
+		inputManager.Process();
+		EXPECT_FLOAT_EQ(moved, 0.75f);
+
+		// Inside the dead zone, then swizzled outside of it.
+		inputManager.Update(Input::GamepadStick::Left, ProcessState::Once, Vector<2>{0.3f, 0.f});
+		inputManager.Process();
+		EXPECT_EQ(looked, (Vector<2>{0.f, 0.f}));
+
+		inputManager.Update(Input::GamepadStick::Left, ProcessState::Once, Vector<2>{0.8f, 0.f});
+		inputManager.Process();
+		EXPECT_EQ(looked, (Vector<2>{0.f, 0.8f}));
+	}
+}
@@ -0,0 +1,103 @@
+#include "../../src/Input/DeadZone.h"
+#include "../../src/Input/Modifiers/DeadZoneModifier.h"
+#include <cmath>
+#include <vector>
+#include <gtest/gtest.h>
+
+namespace Engine3
+{
+	namespace
+	{
+		Vector<2> Apply(const DeadZone& deadZone, Vector<2> value)
+		{
+			float x = value.X();
+			float y = value.Y();
+			deadZone(x, y);
+			return {x, y};
+		}
+	}
+
+	TEST(DeadZone, AxialSnapsToTheAxes)
+	{
+		const DeadZone deadZone{DeadZoneShape::Axial, 0.2f};
+		EXPECT_EQ(Apply(deadZone, {0.1f, 0.9f}), (Vector<2>{0.f, 0.9f}));
+		EXPECT_EQ(Apply(deadZone, {0.15f, 0.15f}), (Vector<2>{0.f, 0.f}));
+	}
+
+	TEST(DeadZone, RadialKeepsTheDirection)
+	{
+		const DeadZone deadZone{DeadZoneShape::Radial, 0.2f};
+
+		// Near an axis, but outside the dead zone, isn't snapped to it.
+		EXPECT_EQ(Apply(deadZone, {0.1f, 0.9f}), (Vector<2>{0.1f, 0.9f}));
+
+		// Each axis is inside the dead zone, but together they're outside of it.
+		EXPECT_EQ(Apply(deadZone, {0.15f, 0.15f}), (Vector<2>{0.15f, 0.15f}));
+		EXPECT_EQ(Apply(deadZone, {0.1f, 0.1f}), (Vector<2>{0.f, 0.f}));
+	}
+
+	TEST(DeadZone, ScaledRadialStartsFromZero)
+	{
+		const DeadZone deadZone{DeadZoneShape::ScaledRadial, 0.2f, 0.9f};
+		EXPECT_EQ(Apply(deadZone, {0.1f, 0.1f}), (Vector<2>{0.f, 0.f}));
+
+		const Vector<2> justOutside = Apply(deadZone, {0.f, 0.21f});
+		EXPECT_NEAR(justOutside.Y(), 0.01f / 0.7f, 1e-5f);
+
+		// Past the outer dead zone counts as fully pushed, in the same direction.
+		const Vector<2> pushed = Apply(deadZone, {0.6f, 0.8f});
+		EXPECT_NEAR(pushed.X(), 0.6f, 1e-5f);
+		EXPECT_NEAR(pushed.Y(), 0.8f, 1e-5f);
+
+		float value = -0.55f;
+		deadZone(value);
+		EXPECT_NEAR(value, -0.5f, 1e-5f);
+	}
+
+	TEST(DeadZone, ResponseCurve)
+	{
+		const DeadZone deadZone{DeadZoneShape::ScaledRadial, 0.f, 1.f, [](float value) { return value * value; }};
+		const Vector<2> curved = Apply(deadZone, {0.3f, 0.4f});
+		EXPECT_NEAR(curved.X(), 0.15f, 1e-5f);
+		EXPECT_NEAR(curved.Y(), 0.2f, 1e-5f);
+
+		float value = -0.5f;
+		deadZone(value);
+		EXPECT_NEAR(value, -0.25f, 1e-5f);
+	}
+
+	TEST(DeadZone, BatchMatchesEachStick)
+	{
+		for (DeadZoneShape shape : {DeadZoneShape::Axial, DeadZoneShape::Radial, DeadZoneShape::ScaledRadial})
+		{
+			const DeadZone deadZone{shape, 0.25f, 0.95f, [](float value) { return std::sqrt(value); }};
+
+			std::vector<float> x, y;
+			for (int i = 0; i < 37; ++i)
+			{
+				x.push_back(std::sin(static_cast<float>(i)) * static_cast<float>(i) / 37.f);
+				y.push_back(std::cos(static_cast<float>(i * 3)) * static_cast<float>(i) / 37.f);
+			}
+
+			std::vector<float> batchX = x, batchY = y;
+			deadZone(batchX, batchY);
+
+			for (std::size_t i = 0; i < x.size(); ++i)
+			{
+				EXPECT_EQ(Apply(deadZone, {x[i], y[i]}), (Vector<2>{batchX[i], batchY[i]}));
+			}
+		}
+	}
+
+	TEST(DeadZone, ModifierIsRadialByDefault)
+	{
+		DeadZoneModifier modifier{0.2f};
+		Vector<2> value{0.15f, 0.15f};
+		modifier(value);
+		EXPECT_EQ(value, (Vector<2>{0.15f, 0.15f}));
+
+		float single = 0.15f;
+		modifier(single);
+		EXPECT_EQ(single, 0.f);
+	}
+}
@@ -0,0 +1,155 @@
+#include "../../src/Core/Events.h"
+#include "../../src/Input/InputLog.h"
+#include "../../src/Input/InputManager.h"
+#include <chrono>
+#include <sstream>
+#include <vector>
+#include <gtest/gtest.h>
+
+namespace Engine3
+{
+	namespace
+	{
+		using namespace std::chrono_literals;
+
+		const InputRecord::Clock::time_point Start{};
+
+		// A few frames of every kind of value, including an empty frame and a controller's input.
+		std::vector<std::vector<InputRecord>> ExampleFrames()
+		{
+			return {
+				{
+					{Start, SDL_SCANCODE_A, ProcessState::Continuous, {}},
+					{Start + 1ms, Input::Mouse::MouseAxisX, ProcessState::Once, 3.f},
+					{Start + 1ms, Input::Mouse::MouseAxisX, ProcessState::Once, -1.5f},
+				},
+				{},
+				{
+					{Start + 40ms, Input::Mouse::Left, ProcessState::Release, Vector<2>{12.f, 34.f}},
+					{Start + 41ms, SDL_CONTROLLER_AXIS_LEFTX, ProcessState::Continuous, 0.25f, 3},
+					{Start + 41ms, SDL_CONTROLLER_BUTTON_A, ProcessState::Continuous, {}, 4, 1},
+					{Start + 42ms, SDL_SCANCODE_A, ProcessState::Release, {}},
+				},
+			};
+		}
+
+		std::string Record(const std::vector<std::vector<InputRecord>>& frames)
+		{
+			std::ostringstream out;
+			InputRecorder recorder{out};
+			for (const std::vector<InputRecord>& frame : frames)
+			{
+				for (const InputRecord& record : frame) { recorder.Record(record); }
+				recorder.EndFrame();
+			}
+
+			return out.str();
+		}
+	}
+
+	TEST(BindingTable, UnpackReversesPack)
+	{
+		for (std::size_t packed = 0; packed < BindingTable::Size; ++packed)
+		{
+			ASSERT_EQ(BindingTable::Pack(BindingTable::Unpack(packed)), packed);
+		}
+
+		EXPECT_EQ(BindingTable::Unpack(BindingTable::Pack(Input::Mouse::MouseWheelY)),
+		          InternalInputType{Input::Mouse::MouseWheelY});
+	}
+
+	TEST(InputLog, RoundTrip)
+	{
+		const std::vector<std::vector<InputRecord>> frames = ExampleFrames();
+		std::istringstream in{Record(frames)};
+
+		// Played back from a different start, keeping the spacing.
+		InputPlayer player;
+		ASSERT_TRUE(player.Load(in, Start + 1h));
+		ASSERT_EQ(player.GetFrameCount(), frames.size());
+
+		for (const std::vector<InputRecord>& expected : frames)
+		{
+			ASSERT_FALSE(player.IsFinished());
+			const std::span<const InputRecord> played = player.NextFrame();
+			ASSERT_EQ(played.size(), expected.size());
+			for (std::size_t i = 0; i < played.size(); ++i)
+			{
+				EXPECT_EQ(played[i].Timestamp, expected[i].Timestamp + 1h);
+				EXPECT_EQ(played[i].Input, expected[i].Input);
+				EXPECT_EQ(played[i].State, expected[i].State);
+				EXPECT_EQ(played[i].Value, expected[i].Value);
+				EXPECT_EQ(played[i].Device, expected[i].Device);
+				EXPECT_EQ(played[i].Player, expected[i].Player);
+			}
+		}
+		EXPECT_TRUE(player.IsFinished());
+
+		player.Rewind();
+		EXPECT_EQ(player.NextFrame().size(), frames[0].size());
+	}
+
+	TEST(InputLog, IsCompact)
+	{
+		// An empty frame is a single byte, and a key press three, after the header.
+		const std::size_t header = Record({}).size();
+		EXPECT_EQ(Record({{}, {}, {}}).size(), header + 3);
+		EXPECT_EQ(Record({{{Start, SDL_SCANCODE_A, ProcessState::Continuous, {}}}}).size(), header + 1 + 3);
+	}
+
+	TEST(InputLog, RejectsTruncatedLogs)
+	{
+		const std::string log = Record(ExampleFrames());
+
+		InputPlayer player;
+		std::istringstream notALog{"hello"};
+		EXPECT_FALSE(player.Load(notALog));
+
+		std::istringstream truncated{log.substr(0, log.size() - 1)};
+		EXPECT_FALSE(player.Load(truncated));
+		EXPECT_EQ(player.GetFrameCount(), 0);
+		EXPECT_TRUE(player.IsFinished());
+	}
+
+	TEST(InputLog, ReplayMatchesTheRecording)
+	{
+		// Records what reaches the input manager, then replays it headlessly into a fresh one.
+		auto bind = [](InputManager& inputManager, std::vector<float>& received)
+		{
+			inputManager.AddAction(std::function([&received](float value) { received.push_back(value); }))
+			            .AddInput(Input::Mouse::MouseAxisX);
+			inputManager.AddAction(std::function([&received] { received.push_back(100.f); }))
+			            .AddInput(Input::Key::A);
+		};
+
+		std::ostringstream out;
+		std::vector<float> recorded;
+		{
+			InputManager inputManager;
+			bind(inputManager, recorded);
+			Events events;
+
+			InputRecorder recorder{out};
+			events.SetInputCallback([&recorder](const InputRecord& record) { recorder.Record(record); });
+			for (const std::vector<InputRecord>& frame : ExampleFrames())
+			{
+				events.Replay(inputManager, frame);
+				recorder.EndFrame();
+			}
+		}
+
+		std::vector<float> replayed;
+		InputManager inputManager;
+		bind(inputManager, replayed);
+		Events events;
+
+		std::istringstream in{out.str()};
+		InputPlayer player;
+		ASSERT_TRUE(player.Load(in));
+		while (!player.IsFinished()) { events.Replay(inputManager, player.NextFrame()); }
+
+		// Key A is held over the empty frame, and the mouse motion coalesced.
+		EXPECT_EQ(recorded, (std::vector<float>{1.5f, 100.f, 100.f, 100.f}));
+		EXPECT_EQ(replayed, recorded);
+	}
+}
@@ -0,0 +1,282 @@
+#include "../../src/Input/InputManager.h"
+#include "../../src/Input/Conditions/PressedCondition.h"
+#include "../../src/Input/Conditions/ReleasedCondition.h"
+#include "../../src/Input/Modifiers/DeadZoneModifier.h"
+#include <set>
+#include <vector>
+#include <gtest/gtest.h>
+
+namespace Engine3
+{
+	namespace
+	{
+		class ScaleModifier : public Modifier
+		{
+		private:
+			float Scale;
+
+		public:
+			explicit ScaleModifier(float scale) : Scale(scale) {}
+
+			void operator()(float& value) override { value *= Scale; }
+
+			void operator()(Vector<2>& value) override { value *= Scale; }
+		};
+
+		// Lets everything through, counting how often it's asked, which is how often its input is processed.
+		class CountingCondition : public Condition
+		{
+		private:
+			int& Count;
+
+		public:
+			explicit CountingCondition(int& count) : Count(count) {}
+
+			bool operator()(const Input&) override { return ++Count, true; }
+		};
+	}
+
+	TEST(BindingTable, PackIsUniqueAndDense)
+	{
+		std::set<std::size_t> packed;
+		for (int i = 0; i < SDL_NUM_SCANCODES; ++i) { packed.insert(BindingTable::Pack(static_cast<SDL_Scancode>(i))); }
+		for (int i = 0; i <= std::to_underlying(Input::Mouse::MouseWheelY); ++i)
+		{
+			packed.insert(BindingTable::Pack(static_cast<Input::Mouse>(i)));
+		}
+		for (int i = 0; i < SDL_CONTROLLER_BUTTON_MAX; ++i)
+		{
+			packed.insert(BindingTable::Pack(static_cast<SDL_GameControllerButton>(i)));
+		}
+		for (int i = 0; i < SDL_CONTROLLER_AXIS_MAX; ++i)
+		{
+			packed.insert(BindingTable::Pack(static_cast<SDL_GameControllerAxis>(i)));
+		}
+		for (Input::GamepadStick stick : {Input::GamepadStick::Left, Input::GamepadStick::Right})
+		{
+			packed.insert(BindingTable::Pack(stick));
+		}
+
+		EXPECT_EQ(packed.size(), BindingTable::Size);
+		EXPECT_EQ(*packed.rbegin(), BindingTable::Size - 1);
+	}
+
+	TEST(InputManager, UpdateOnlyReachesBoundActions)
+	{
+		InputManager inputManager;
+		std::vector<int> calls(3, 0);
+		inputManager.AddAction(std::function([&calls] { ++calls[0]; })).AddInput(Input::Key::A);
+		inputManager.AddAction(std::function([&calls] { ++calls[1]; })).AddInput(Input::Key::B);
+		Action& both = inputManager.AddAction(std::function([&calls] { ++calls[2]; }));
+		both.AddInput(Input::Key::B);
+		both.AddInput(Input::Mouse::Left);
+
+		inputManager.Update(SDL_SCANCODE_B, ProcessState::Once, {});
+		inputManager.Process();
+
+		EXPECT_EQ(calls, (std::vector<int>{0, 1, 1}));
+	}
+
+	TEST(InputManager, BindingTheSameInputTwice)
+	{
+		InputManager inputManager;
+		std::vector<float> received;
+		Action& action = inputManager.AddAction(std::function([&received](float value) { received.push_back(value); }),
+		                                        true);
+		Input* first = &action.AddInput(Input::Mouse::MouseAxisX);
+		EXPECT_EQ(&action.AddInput(Input::Mouse::MouseAxisX), first);
+
+		// Bound once, so the value isn't cumulated with itself.
+		inputManager.Update(Input::Mouse::MouseAxisX, ProcessState::Once, 2.f);
+		inputManager.Process();
+
+		EXPECT_EQ(received, (std::vector<float>{2.f}));
+	}
+
+	TEST(InputManager, BindingAfterDispatch)
+	{
+		// The first dispatch groups the bindings, which has to be redone when more are added.
+		InputManager inputManager;
+		std::vector<int> calls(2, 0);
+		inputManager.AddAction(std::function([&calls] { ++calls[0]; })).AddInput(Input::Key::A);
+		inputManager.Update(SDL_SCANCODE_A, ProcessState::Once, {});
+
+		inputManager.AddAction(std::function([&calls] { ++calls[1]; })).AddInput(Input::GamepadButton::A);
+		inputManager.Update(SDL_CONTROLLER_BUTTON_A, ProcessState::Once, {});
+		inputManager.Process();
+
+		EXPECT_EQ(calls, (std::vector<int>{1, 1}));
+	}
+
+	TEST(InputManager, BuiltInAndCustomModifiers)
+	{
+		InputManager inputManager;
+		std::vector<float> received;
+		inputManager.AddAction(std::function([&received](float value) { received.push_back(value); }))
+		            .AddInput(Input::Mouse::MouseAxisX)
+		            .AddModifier<DeadZoneModifier>(0.5f)
+		            .AddModifier<ScaleModifier>(3.f);
+
+		inputManager.Update(Input::Mouse::MouseAxisX, ProcessState::Once, 0.25f);
+		inputManager.Process();
+		inputManager.Update(Input::Mouse::MouseAxisX, ProcessState::Once, 2.f);
+		inputManager.Process();
+
+		EXPECT_EQ(received, (std::vector<float>{0.f, 6.f}));
+	}
+
+	TEST(InputManager, ConditionKeepsItsState)
+	{
+		// Only the first frame of a held key counts as a press.
+		InputManager inputManager;
+		int presses = 0;
+		inputManager.AddAction(std::function([&presses] { ++presses; }))
+		            .AddInput(Input::Key::A)
+		            .AddCondition<PressedCondition>();
+
+		inputManager.Update(SDL_SCANCODE_A, ProcessState::Continuous, {});
+		for (int i = 0; i < 3; ++i) { inputManager.Process(); }
+
+		EXPECT_EQ(presses, 1);
+	}
+
+	TEST(InputManager, PressAndReleaseInOneFrame)
+	{
+		InputManager inputManager;
+		std::vector<int> calls(2, 0);
+		inputManager.AddAction(std::function([&calls] { ++calls[0]; }))
+		            .AddInput(Input::Key::A)
+		            .AddCondition<PressedCondition>();
+		inputManager.AddAction(std::function([&calls] { ++calls[1]; }))
+		            .AddInput(Input::Key::A)
+		            .AddCondition<ReleasedCondition>();
+
+		inputManager.Update(SDL_SCANCODE_A, ProcessState::Continuous, {});
+		inputManager.Update(SDL_SCANCODE_A, ProcessState::Release, {});
+		inputManager.Process();
+		EXPECT_EQ(calls, (std::vector{1, 1}));
+
+		// Released and pressed again in the next, so it's still held afterwards.
+		inputManager.Update(SDL_SCANCODE_A, ProcessState::Continuous, {});
+		inputManager.Process();
+		inputManager.Update(SDL_SCANCODE_A, ProcessState::Release, {});
+		inputManager.Update(SDL_SCANCODE_A, ProcessState::Continuous, {});
+		inputManager.Process();
+		EXPECT_EQ(calls, (std::vector{3, 2}));
+
+		inputManager.Process();
+		EXPECT_EQ(calls, (std::vector{3, 2}));
+	}
+
+	TEST(InputManager, RejectedReleaseStillStops)
+	{
+		// The release fails the pressed condition, but must still stop the input so the action stops being processed.
+		InputManager inputManager;
+		int presses = 0;
+		int evaluations = 0;
+		inputManager.AddAction(std::function([&presses] { ++presses; }))
+		            .AddInput(Input::Key::A)
+		            .AddCondition<CountingCondition>(evaluations)
+		            .AddCondition<PressedCondition>();
+
+		inputManager.Update(SDL_SCANCODE_A, ProcessState::Continuous, {});
+		inputManager.Process();
+		inputManager.Update(SDL_SCANCODE_A, ProcessState::Release, {});
+		inputManager.Process();
+		EXPECT_EQ(presses, 1);
+		EXPECT_EQ(evaluations, 2);
+
+		for (int i = 0; i < 100; ++i) { inputManager.Process(); }
+		EXPECT_EQ(evaluations, 2);
+
+		// And it's pressed again as normal.
+		inputManager.Update(SDL_SCANCODE_A, ProcessState::Continuous, {});
+		inputManager.Process();
+		EXPECT_EQ(presses, 2);
+	}
+
+	TEST(InputManager, HeldInputsStayActive)
+	{
+		InputManager inputManager;
+		std::vector<int> calls(2, 0);
+		inputManager.AddAction(std::function([&calls] { ++calls[0]; })).AddInput(Input::Key::A);
+		inputManager.AddAction(std::function([&calls] { ++calls[1]; })).AddInput(Input::Key::B);
+
+		inputManager.Update(SDL_SCANCODE_A, ProcessState::Continuous, {});
+		inputManager.Update(SDL_SCANCODE_B, ProcessState::Once, {});
+		for (int i = 0; i < 3; ++i) { inputManager.Process(); }
+		EXPECT_EQ(calls, (std::vector<int>{3, 1}));
+
+		inputManager.Update(SDL_SCANCODE_A, ProcessState::Stop, {});
+		inputManager.Process();
+		EXPECT_EQ(calls, (std::vector<int>{3, 1}));
+
+		// Stopping and restarting an input before it's processed mustn't make it count twice.
+		std::vector<float> received;
+		Action& action = inputManager.AddAction(std::function([&received](float value) { received.push_back(value); }),
+		                                        true);
+		action.AddInput(Input::Mouse::MouseAxisX);
+		inputManager.Update(Input::Mouse::MouseAxisX, ProcessState::Once, 1.f);
+		inputManager.Update(Input::Mouse::MouseAxisX, ProcessState::Stop, 0.f);
+		inputManager.Update(Input::Mouse::MouseAxisX, ProcessState::Once, 2.f);
+		inputManager.Process();
+		inputManager.Process();
+		EXPECT_EQ(received, (std::vector<float>{2.f}));
+	}
+
+	TEST(InputManager, ProcessesInTheOrderAdded)
+	{
+		InputManager inputManager;
+		std::vector<int> order;
+		inputManager.AddAction(std::function([&order] { order.push_back(0); })).AddInput(Input::Key::A);
+		inputManager.AddAction(std::function([&order] { order.push_back(1); })).AddInput(Input::Key::B);
+
+		inputManager.Update(SDL_SCANCODE_B, ProcessState::Once, {});
+		inputManager.Update(SDL_SCANCODE_A, ProcessState::Once, {});
+		inputManager.Process();
+
+		EXPECT_EQ(order, (std::vector<int>{0, 1}));
+	}
+
+	TEST(InputManager, UpdatingFromAnAction)
+	{
+		// An earlier action updated by a later one has already been processed, so it waits until the next Process.
+		InputManager inputManager;
+		std::vector<int> calls(2, 0);
+		inputManager.AddAction(std::function([&calls] { ++calls[0]; })).AddInput(Input::Key::A);
+		inputManager.AddAction(std::function([&calls, &inputManager]
+		{
+			++calls[1];
+			inputManager.Update(SDL_SCANCODE_A, ProcessState::Once, {});
+		})).AddInput(Input::Key::B);
+
+		inputManager.Update(SDL_SCANCODE_B, ProcessState::Once, {});
+		inputManager.Process();
+		EXPECT_EQ(calls, (std::vector<int>{0, 1}));
+
+		inputManager.Process();
+		EXPECT_EQ(calls, (std::vector<int>{1, 1}));
+	}
+
+	TEST(InputManager, PerPlayerBindings)
+	{
+		InputManager inputManager;
+		std::vector<int> calls(3, 0);
+		inputManager.AddAction(std::function([&calls] { ++calls[0]; })).AddInput(Input::GamepadButton::A, 0);
+		inputManager.AddAction(std::function([&calls] { ++calls[1]; })).AddInput(Input::GamepadButton::A, 1);
+		inputManager.AddAction(std::function([&calls] { ++calls[2]; })).AddInput(Input::GamepadButton::A);
+
+		inputManager.Update(SDL_CONTROLLER_BUTTON_A, ProcessState::Once, {}, 1);
+		inputManager.Process();
+		EXPECT_EQ(calls, (std::vector<int>{0, 1, 1}));
+
+		// Without a player, only what's bound for any player is triggered.
+		inputManager.Update(SDL_CONTROLLER_BUTTON_A, ProcessState::Once, {});
+		inputManager.Process();
+		EXPECT_EQ(calls, (std::vector<int>{0, 1, 2}));
+
+		// The same input for two players is two separate inputs.
+		Action& both = inputManager.AddAction(std::function([] {}));
+		EXPECT_NE(&both.AddInput(Input::GamepadButton::B, 0), &both.AddInput(Input::GamepadButton::B, 1));
+	}
+}
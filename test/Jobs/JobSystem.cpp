@@ -0,0 +1,118 @@
+#include "../../src/Jobs/JobSystem.h"
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#include <gtest/gtest.h>
+
+namespace Engine3
+{
+	TEST(JobSystem, RunsEveryJob)
+	{
+		JobSystem jobs{4};
+		std::atomic<int> sum = 0;
+
+		JobCounter counter;
+		for (int i = 1; i <= 100; ++i) { jobs.Run([&sum, i] { sum += i; }, counter); }
+		jobs.Wait(counter);
+
+		EXPECT_TRUE(counter.IsDone());
+		EXPECT_EQ(sum, 5050);
+	}
+
+	TEST(JobSystem, SingleThreadRunsJobsWhileWaiting)
+	{
+		JobSystem jobs{1};
+		int count = 0;
+
+		JobCounter counter;
+		for (int i = 0; i < 10; ++i) { jobs.Run([&count] { ++count; }, counter); }
+		EXPECT_EQ(count, 0);
+
+		jobs.Wait(counter);
+		EXPECT_EQ(count, 10);
+	}
+
+	TEST(JobSystem, DependencyRunsAfterwards)
+	{
+		JobSystem jobs{4};
+		std::vector<int> values(64, 0);
+		std::atomic<bool> dependentSawEveryValue = true;
+
+		JobCounter first, second;
+		for (int& value : values) { jobs.Run([&value] { value = 1; }, first); }
+		jobs.Run([&]
+		{
+			for (const int value : values) { if (value != 1) { dependentSawEveryValue = false; } }
+		}, second, first);
+		jobs.Wait(second);
+
+		EXPECT_TRUE(first.IsDone());
+		EXPECT_TRUE(dependentSawEveryValue);
+	}
+
+	TEST(JobSystem, DependencyAlreadyDone)
+	{
+		JobSystem jobs{2};
+		bool ran = false;
+
+		JobCounter done, counter;
+		jobs.Run([&ran] { ran = true; }, counter, done);
+		jobs.Wait(counter);
+
+		EXPECT_TRUE(ran);
+	}
+
+	TEST(JobSystem, WaitingInsideAJob)
+	{
+		// Every thread waits on jobs it has spawned, which would deadlock if waiting didn't run them.
+		JobSystem jobs{2};
+		std::atomic<int> count = 0;
+
+		JobCounter outer;
+		for (int i = 0; i < 8; ++i)
+		{
+			jobs.Run([&jobs, &count]
+			{
+				JobCounter inner;
+				for (int j = 0; j < 8; ++j) { jobs.Run([&count] { ++count; }, inner); }
+				jobs.Wait(inner);
+			}, outer);
+		}
+		jobs.Wait(outer);
+
+		EXPECT_EQ(count, 64);
+	}
+
+	TEST(JobSystem, ParallelForCoversEveryIndexOnce)
+	{
+		JobSystem jobs{4};
+		std::vector<int> visits(1001, 0);
+
+		jobs.ParallelFor(visits.size(), [&visits](std::size_t begin, std::size_t end)
+		{
+			for (std::size_t i = begin; i < end; ++i) { ++visits[i]; }
+		});
+
+		EXPECT_EQ(std::count(visits.begin(), visits.end(), 1), visits.size());
+	}
+
+	TEST(JobSystem, ParallelForMinimumBatchSize)
+	{
+		JobSystem jobs{4};
+		std::atomic<int> batches = 0;
+
+		jobs.ParallelFor(100, [&batches](std::size_t, std::size_t) { ++batches; }, 50);
+
+		EXPECT_EQ(batches, 2);
+	}
+
+	TEST(JobSystem, ParallelForEmpty)
+	{
+		JobSystem jobs{2};
+		bool called = false;
+
+		jobs.ParallelFor(0, [&called](std::size_t, std::size_t) { called = true; });
+
+		EXPECT_FALSE(called);
+	}
+}
@@ -91,4 +91,139 @@ namespace Engine3
 
 		EXPECT_THAT(actual, Pointwise(NearWithPrecision(0.001), expected));
 	}
+
+	// Float 4x4 products take a SIMD path at runtime and the generic path during constant evaluation.
+	// The SIMD path accumulates in the same order, so the two should be identical rather than just close.
+	constexpr Matrix<4> ProductLhs
+	{
+		0.9397f, 0.f, -0.342f, 0.f,
+		0.1170f, 0.9397f, 0.3214f, 0.f,
+		0.3214f, -0.342f, 0.8830f, 0.f,
+		4.f, -2.5f, 3.75f, 1.f
+	};
+
+	constexpr Matrix<4> ProductRhs
+	{
+		1.5f, 0.25f, -3.f, 0.1f,
+		-0.7f, 2.f, 0.33f, 0.f,
+		0.125f, -1.f, 1.f, 0.2f,
+		9.f, 0.5f, -6.f, 1.f
+	};
+
+	TEST(Matrix4x4Float, RuntimeProductMatchesConstantEvaluation)
+	{
+		constexpr Matrix<4> expected = ProductLhs * ProductRhs;
+
+		Matrix<4> lhs = ProductLhs;
+		Matrix<4> rhs = ProductRhs;
+		Matrix<4> actual = lhs * rhs;
+
+		EXPECT_EQ(actual, expected);
+	}
+
+	TEST(Matrix4x4Float, RuntimeRowVectorProductMatchesConstantEvaluation)
+	{
+		constexpr Vector<4> vector{3.f, -1.25f, 0.5f, 1.f};
+		constexpr Vector<4> expected = vector * ProductLhs;
+
+		Vector<4> lhs = vector;
+		Matrix<4> rhs = ProductLhs;
+		Vector<4> actual = lhs * rhs;
+
+		EXPECT_EQ(actual, expected);
+	}
+
+	TEST(Matrix4x4Float, RuntimeColumnVectorProductMatchesConstantEvaluation)
+	{
+		constexpr Vector<4> vector{3.f, -1.25f, 0.5f, 1.f};
+		constexpr Vector<4> expected = ProductRhs * vector;
+
+		Matrix<4> lhs = ProductRhs;
+		Vector<4> rhs = vector;
+		Vector<4> actual = lhs * rhs;
+
+		EXPECT_EQ(actual, expected);
+	}
+
+	TEST(Matrix4x4Float, RuntimeTranslatePoint)
+	{
+		Vector<4> point{1.f, 2.f, 3.f, 1.f};
+		Vector<4> actual = point * Matrix<4>::Translation(4, 2, 3);
+
+		Vector<4> expected{5.f, 4.f, 6.f, 1.f};
+		EXPECT_EQ(actual, expected);
+	}
+
+	TEST(Matrix4x4Float, DeterminantMatchesCofactorExpansion)
+	{
+		const auto& generic = static_cast<const Detail::MatrixBase<4, 4, float>&>(ProductRhs);
+
+		EXPECT_NEAR(ProductRhs.Determinant(), generic.Determinant(), 0.0001);
+	}
+
+	TEST(Matrix4x4Float, InvertedMatchesCofactorExpansion)
+	{
+		const auto& generic = static_cast<const Detail::MatrixBase<4, 4, float>&>(ProductRhs);
+
+		Matrix<4> actual = ProductRhs.Inverted();
+		Matrix<4> expected = generic.Inverted();
+
+		EXPECT_THAT(actual, Pointwise(NearWithPrecision(0.0001), expected));
+	}
+
+	TEST(Matrix4x4Float, InvertedProductIsIdentity)
+	{
+		Matrix<4> actual = ProductRhs * ProductRhs.Inverted();
+
+		EXPECT_THAT(actual, Pointwise(NearWithPrecision(0.0001), Matrix<4>::Identity()));
+	}
+
+	TEST(Matrix4x4Float, InvertedAffine)
+	{
+		const Matrix<4> affine = Matrix<4>::ScalingAlongCardinalAxes(2.f, 0.5f, 4.f) * Matrix<4>::RotationAboutY(0.6f) *
+			Matrix<4>::Translation(3, -7, 1.5f);
+
+		Matrix<4> actual = affine.InvertedAffine();
+		Matrix<4> expected = affine.Inverted();
+
+		EXPECT_THAT(actual, Pointwise(NearWithPrecision(0.0001), expected));
+	}
+
+	TEST(Matrix4x4Float, InvertedOrthonormal)
+	{
+		Matrix<4> actual =
+			Matrix<4>{
+				-0.1495f, -0.1986f, -0.9685f, 0.f,
+				-0.8256f, 0.5640f, 0.0117f, 0.f,
+				-0.5439f, -0.8015f, 0.2484f, 0.f,
+				1.7928f, -5.3116f, 8.0151f, 1.f
+			}.InvertedOrthonormal();
+
+		Matrix<4> expected
+		{
+			-0.1495f, -0.8256f, -0.5439f, 0.f,
+			-0.1986f, 0.5640f, -0.8015f, 0.f,
+			-0.9685f, 0.0117f, 0.2484f, 0.f,
+			6.9764f, 4.3817f, -5.2724f, 1.f
+		};
+
+		EXPECT_THAT(actual, Pointwise(NearWithPrecision(0.001), expected));
+	}
+
+	TEST(Matrix4x4Float, ConstantEvaluatedInverse)
+	{
+		constexpr Matrix<4> rigid
+		{
+			0.6f, 0.8f, 0.f, 0.f,
+			-0.8f, 0.6f, 0.f, 0.f,
+			0.f, 0.f, 1.f, 0.f,
+			1.f, 2.f, 3.f, 1.f
+		};
+		constexpr Matrix<4> inverse = rigid.InvertedOrthonormal();
+		constexpr Matrix<4> identity = rigid * inverse;
+		constexpr Matrix<4> generalIdentity = ProductRhs * ProductRhs.Inverted();
+
+		EXPECT_THAT(identity, Pointwise(NearWithPrecision(0.0001), Matrix<4>::Identity()));
+		EXPECT_THAT(generalIdentity, Pointwise(NearWithPrecision(0.0001), Matrix<4>::Identity()));
+	}
 }
@@ -1,8 +1,42 @@
+#include "../CustomMatchers.h"
 #include "../../src/Maths/Quaternion.h"
+#include <algorithm>
+#include <vector>
+#include <gmock/gmock.h>
 #include "gtest/gtest.h"
+using testing::Pointwise;
 
 namespace Engine3
 {
+	namespace
+	{
+		std::vector<Quaternion<float>> TestRotations()
+		{
+			// Not a multiple of four, so the scalar remainder of the batch functions is exercised.
+			std::vector<Quaternion<float>> rotations;
+			for (std::size_t i = 0; i < 7; ++i)
+			{
+				const float value = static_cast<float>(i);
+				const Vector<3> axis = Vector<3>{value - 3.f, 1.f, value * 0.5f}.Normalised();
+				rotations.push_back(Quaternion<float>::FromAxisAngle(axis, value * 0.9f - 2.f));
+			}
+
+			return rotations;
+		}
+
+		std::vector<Vector<3>> TestVectors()
+		{
+			std::vector<Vector<3>> vectors;
+			for (std::size_t i = 0; i < 7; ++i)
+			{
+				const float value = static_cast<float>(i);
+				vectors.push_back({value, 2.f - value, value * value * 0.25f});
+			}
+
+			return vectors;
+		}
+	}
+
 	TEST(Quaternion_Float, Construction)
 	{
 		constexpr Quaternion actual = Quaternion<float>::Identity();
@@ -12,4 +46,183 @@ namespace Engine3
 		EXPECT_FLOAT_EQ(0, actual.Z);
 		EXPECT_FLOAT_EQ(1, actual.W);
 	}
+
+	TEST(Quaternion_Float, ToMatrixMatchesRotationAbout)
+	{
+		const float radians = 0.8f;
+
+		EXPECT_THAT(Quaternion<float>::FromAxisAngle({1, 0, 0}, radians).ToMatrix(),
+		            Pointwise(NearWithPrecision(0.0001), Matrix<3>::RotationAboutX(radians)));
+		EXPECT_THAT(Quaternion<float>::FromAxisAngle({0, 1, 0}, radians).ToMatrix(),
+		            Pointwise(NearWithPrecision(0.0001), Matrix<3>::RotationAboutY(radians)));
+		EXPECT_THAT(Quaternion<float>::FromAxisAngle({0, 0, 1}, radians).ToMatrix<4>(),
+		            Pointwise(NearWithPrecision(0.0001), Matrix<4>::RotationAboutZ(radians)));
+	}
+
+	TEST(Quaternion_Float, ToMatrixMatchesRotationAboutAxis)
+	{
+		const Vector<3> axis = Vector<3>{1, -2, 0.5f}.Normalised();
+
+		EXPECT_THAT(Quaternion<float>::FromAxisAngle(axis, 2.1f).ToMatrix(),
+		            Pointwise(NearWithPrecision(0.0001), Matrix<3>::RotationAboutAxis(axis, 2.1f)));
+	}
+
+	TEST(Quaternion_Float, RotateMatchesMatrix)
+	{
+		for (const Quaternion<float>& rotation : TestRotations())
+		{
+			for (const Vector<3>& vector : TestVectors())
+			{
+				EXPECT_THAT(rotation.Rotate(vector), Pointwise(NearWithPrecision(0.0001), vector * rotation.ToMatrix()));
+			}
+		}
+	}
+
+	TEST(Quaternion_Float, FromMatrixRoundTrip)
+	{
+		// Includes rotations near 180 degrees, where the trace is negative.
+		std::vector<Quaternion<float>> rotations = TestRotations();
+		rotations.push_back(Quaternion<float>::FromAxisAngle({1, 0, 0}, 3.1f));
+		rotations.push_back(Quaternion<float>::FromAxisAngle({0, 1, 0}, 3.1f));
+		rotations.push_back(Quaternion<float>::FromAxisAngle({0, 0, 1}, 3.1f));
+
+		for (const Quaternion<float>& expected : rotations)
+		{
+			Quaternion<float> actual = Quaternion<float>::FromMatrix(expected.ToMatrix<4>());
+
+			// q and -q are the same rotation.
+			if (Quaternion<float>::DotProduct(actual, expected) < 0) { actual = -actual; }
+
+			EXPECT_NEAR(actual.X, expected.X, 0.0001);
+			EXPECT_NEAR(actual.Y, expected.Y, 0.0001);
+			EXPECT_NEAR(actual.Z, expected.Z, 0.0001);
+			EXPECT_NEAR(actual.W, expected.W, 0.0001);
+		}
+	}
+
+	TEST(Quaternion_Float, BatchRotate)
+	{
+		const std::vector<Quaternion<float>> rotations = TestRotations();
+		const std::vector<Vector<3>> vectors = TestVectors();
+
+		std::vector<Vector<3>> actual(vectors.size());
+		Rotate(rotations, vectors, actual);
+
+		for (std::size_t i = 0; i < vectors.size(); ++i)
+		{
+			EXPECT_THAT(actual[i], Pointwise(NearWithPrecision(0.0001), rotations[i].Rotate(vectors[i])));
+		}
+	}
+
+	TEST(Quaternion_Float, BatchRotateBySingleQuaternion)
+	{
+		const Quaternion<float> rotation = TestRotations()[2];
+		const std::vector<Vector<3>> vectors = TestVectors();
+
+		std::vector<Vector<3>> actual(vectors.size());
+		Rotate(rotation, vectors, actual);
+
+		for (std::size_t i = 0; i < vectors.size(); ++i)
+		{
+			EXPECT_THAT(actual[i], Pointwise(NearWithPrecision(0.0001), rotation.Rotate(vectors[i])));
+		}
+	}
+
+	TEST(Quaternion_Float, BatchToMatrices)
+	{
+		const std::vector<Quaternion<float>> rotations = TestRotations();
+
+		std::vector<Matrix<4>> actual(rotations.size());
+		ToMatrices(rotations, actual);
+
+		for (std::size_t i = 0; i < rotations.size(); ++i)
+		{
+			EXPECT_THAT(actual[i], Pointwise(NearWithPrecision(0.0001), rotations[i].ToMatrix<4>()));
+		}
+	}
+
+	TEST(Quaternion_Float, DotProduct)
+	{
+		constexpr Quaternion<float> lhs{1, 2, 3, 4};
+		constexpr Quaternion<float> rhs{5, 6, 7, 8};
+
+		EXPECT_FLOAT_EQ(Quaternion<float>::DotProduct(lhs, rhs), 70);
+	}
+
+	TEST(Quaternion_Float, SphericalLinearInterpolation)
+	{
+		const Quaternion<float> start = Quaternion<float>::Identity();
+		const Quaternion<float> end = Quaternion<float>::FromAxisAngle({0, 0, 1}, 1.5f);
+		const Quaternion<float> expected = Quaternion<float>::FromAxisAngle({0, 0, 1}, 0.5f);
+
+		const Quaternion<float> actual = SphericalLinearInterpolation(start, end, 1.f / 3);
+		EXPECT_NEAR(actual.Z, expected.Z, 0.0001);
+		EXPECT_NEAR(actual.W, expected.W, 0.0001);
+
+		// The negated end is the same orientation, so the shorter arc gives the same result.
+		const Quaternion<float> negated = SphericalLinearInterpolation(start, -end, 1.f / 3);
+		EXPECT_NEAR(negated.Z, expected.Z, 0.0001);
+		EXPECT_NEAR(negated.W, expected.W, 0.0001);
+	}
+
+	TEST(Quaternion_Float, NormalisedLinearInterpolation)
+	{
+		const std::vector<Quaternion<float>> rotations = TestRotations();
+		for (std::size_t i = 1; i < rotations.size(); ++i)
+		{
+			const Quaternion<float> start = NormalisedLinearInterpolation(rotations[i - 1], rotations[i], 0.f);
+			const Quaternion<float> middle = NormalisedLinearInterpolation(rotations[i - 1], rotations[i], 0.5f);
+			const Quaternion<float> exactMiddle = SphericalLinearInterpolation(rotations[i - 1], rotations[i], 0.5f);
+
+			EXPECT_NEAR(start.DotProduct(rotations[i - 1]), 1, 0.0001);
+			EXPECT_TRUE(middle.IsUnit());
+
+			// Halfway is the one point where the two agree, by symmetry.
+			EXPECT_NEAR(std::abs(middle.DotProduct(exactMiddle)), 1, 0.0001);
+		}
+	}
+
+	TEST(Quaternion_Float, ApproximateSphericalLinearInterpolation)
+	{
+		const std::vector<Quaternion<float>> rotations = TestRotations();
+		for (const Quaternion<float>& start : rotations)
+		{
+			for (const Quaternion<float>& end : rotations)
+			{
+				for (float fraction = 0; fraction <= 1; fraction += 0.125f)
+				{
+					const Quaternion<float> expected = SphericalLinearInterpolation(start, end, fraction);
+					const Quaternion<float> actual = ApproximateSphericalLinearInterpolation(start, end, fraction);
+
+					EXPECT_NEAR(actual.X, expected.X, 0.00005);
+					EXPECT_NEAR(actual.Y, expected.Y, 0.00005);
+					EXPECT_NEAR(actual.Z, expected.Z, 0.00005);
+					EXPECT_NEAR(actual.W, expected.W, 0.00005);
+				}
+			}
+		}
+	}
+
+	TEST(Quaternion_Float, BatchApproximateSphericalLinearInterpolation)
+	{
+		const std::vector<Quaternion<float>> starts = TestRotations();
+		std::vector<Quaternion<float>> ends = TestRotations();
+		std::rotate(ends.begin(), ends.begin() + 3, ends.end());
+
+		std::vector<float> fractions;
+		for (std::size_t i = 0; i < starts.size(); ++i) { fractions.push_back(static_cast<float>(i) / 6); }
+
+		std::vector<Quaternion<float>> actual(starts.size());
+		ApproximateSphericalLinearInterpolation(starts, ends, fractions, actual);
+
+		for (std::size_t i = 0; i < starts.size(); ++i)
+		{
+			const Quaternion<float> expected = ApproximateSphericalLinearInterpolation(starts[i], ends[i], fractions[i]);
+
+			EXPECT_FLOAT_EQ(actual[i].X, expected.X);
+			EXPECT_FLOAT_EQ(actual[i].Y, expected.Y);
+			EXPECT_FLOAT_EQ(actual[i].Z, expected.Z);
+			EXPECT_FLOAT_EQ(actual[i].W, expected.W);
+		}
+	}
 }
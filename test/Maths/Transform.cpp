@@ -0,0 +1,126 @@
+#include "../CustomMatchers.h"
+#include "../../src/Maths/Transform.h"
+#include <vector>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+using testing::Pointwise;
+
+namespace Engine3
+{
+	namespace
+	{
+		// Not a multiple of four, so the scalar remainder is exercised as well as the vectorised groups.
+		std::vector<Vector<3>> TestVectors(std::size_t count = 11)
+		{
+			std::vector<Vector<3>> vectors(count);
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				const float value = static_cast<float>(i);
+				vectors[i] = {value * 0.5f - 2.f, 3.f - value * 0.25f, value * value * 0.125f + 1.f};
+			}
+
+			return vectors;
+		}
+
+		const Matrix<4> TestMatrix =
+			Matrix<4>::ScalingAlongCardinalAxes(2.f, 0.5f, 3.f) * Matrix<4>::RotationAboutY(0.7f) *
+			Matrix<4>::RotationAboutX(-0.3f) * Matrix<4>::Translation(4.f, -1.f, 2.5f);
+
+		Vector<3> Truncate(const Vector<4>& vector) { return {vector.X(), vector.Y(), vector.Z()}; }
+	}
+
+	TEST(Transform, Points)
+	{
+		const std::vector<Vector<3>> points = TestVectors();
+		std::vector<Vector<3>> actual(points.size());
+		TransformPoints(points, actual, TestMatrix);
+
+		for (std::size_t i = 0; i < points.size(); ++i)
+		{
+			const Vector<3> expected = Truncate(Vector<4>{points[i].X(), points[i].Y(), points[i].Z(), 1} * TestMatrix);
+			EXPECT_THAT(actual[i], Pointwise(NearWithPrecision(0.0001), expected));
+		}
+	}
+
+	TEST(Transform, Directions)
+	{
+		const std::vector<Vector<3>> directions = TestVectors();
+		std::vector<Vector<3>> actual(directions.size());
+		TransformDirections(directions, actual, TestMatrix);
+
+		for (std::size_t i = 0; i < directions.size(); ++i)
+		{
+			const Vector<3> expected =
+				Truncate(Vector<4>{directions[i].X(), directions[i].Y(), directions[i].Z(), 0} * TestMatrix);
+			EXPECT_THAT(actual[i], Pointwise(NearWithPrecision(0.0001), expected));
+		}
+	}
+
+	TEST(Transform, NormalsStayPerpendicular)
+	{
+		// Any vector perpendicular to the normal lies in the surface, so should still be after transformation.
+		const std::vector<Vector<3>> normals = TestVectors();
+		std::vector<Vector<3>> tangents(normals.size());
+		for (std::size_t i = 0; i < normals.size(); ++i)
+		{
+			tangents[i] = Vector<3>::CrossProduct(normals[i], {0.f, 1.f, 0.f});
+		}
+
+		std::vector<Vector<3>> transformedNormals(normals.size());
+		std::vector<Vector<3>> transformedTangents(normals.size());
+		TransformNormals(normals, transformedNormals, TestMatrix);
+		TransformDirections(tangents, transformedTangents, TestMatrix);
+
+		for (std::size_t i = 0; i < normals.size(); ++i)
+		{
+			EXPECT_NEAR(Vector<3>::DotProduct(transformedNormals[i], transformedTangents[i]), 0, 0.001);
+		}
+	}
+
+	TEST(Transform, PointsProjective)
+	{
+		const Matrix<4> matrix = TestMatrix * Matrix<4>::PerspectiveProjection(2.f);
+		const std::vector<Vector<3>> points = TestVectors();
+		std::vector<Vector<3>> actual(points.size());
+		TransformPointsProjective(points, actual, matrix);
+
+		for (std::size_t i = 0; i < points.size(); ++i)
+		{
+			const Vector<4> homogeneous = Vector<4>{points[i].X(), points[i].Y(), points[i].Z(), 1} * matrix;
+			const Vector<3> expected = Truncate(homogeneous) / homogeneous.W();
+			EXPECT_THAT(actual[i], Pointwise(NearWithPrecision(0.0001), expected));
+		}
+	}
+
+	TEST(Transform, InPlace)
+	{
+		std::vector<Vector<3>> points = TestVectors();
+		std::vector<Vector<3>> expected(points.size());
+		TransformPoints(points, expected, TestMatrix);
+
+		TransformPoints(points, points, TestMatrix);
+
+		EXPECT_EQ(points, expected);
+	}
+
+	TEST(Transform, ThreadedMatchesSingleThreaded)
+	{
+		// Enough for several threads, with a remainder for the last one.
+		const std::vector<Vector<3>> points = TestVectors(Detail::MinimumVectorsPerThread * 4 + 3);
+		std::vector<Vector<3>> expected(points.size());
+		std::vector<Vector<3>> actual(points.size());
+
+		TransformPoints(points, expected, TestMatrix);
+		TransformPoints(points, actual, TestMatrix, 4);
+
+		EXPECT_EQ(actual, expected);
+	}
+
+	TEST(Transform, Empty)
+	{
+		std::vector<Vector<3>> points;
+		TransformPoints(points, points, TestMatrix, 4);
+
+		EXPECT_TRUE(points.empty());
+	}
+}
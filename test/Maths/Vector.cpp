@@ -457,6 +457,34 @@ namespace Engine3
 		static_assert(non_unit.IsUnit() == false);
 	}
 
+	// The float Vector<4> operations take a SIMD path at runtime, and the scalar path during constant evaluation.
+	// Both paths should agree.
+	TEST(Vector4Float, RuntimeArithmetic)
+	{
+		constexpr Vector<4> a{4.f, -4.f, -4.f, 4.f};
+		constexpr Vector<4> b{-6.f, 6.f, 6.f, -6.f};
+		constexpr float expectedDotProduct = Vector<4>::DotProduct(a, b);
+
+		Vector<4> lhs = a;
+		Vector<4> rhs = b;
+		EXPECT_FLOAT_EQ(Vector<4>::DotProduct(lhs, rhs), expectedDotProduct);
+		EXPECT_EQ(lhs + rhs, (Vector<4>{-2.f, 2.f, 2.f, -2.f}));
+		EXPECT_EQ(lhs - rhs, (Vector<4>{10.f, -10.f, -10.f, 10.f}));
+		EXPECT_EQ(lhs * 2.f, (Vector<4>{8.f, -8.f, -8.f, 8.f}));
+		EXPECT_FLOAT_EQ(Vector<4>::Distance(lhs, rhs), 20.f);
+	}
+
+	TEST(Vector4Float, RuntimeNormalise)
+	{
+		Vector<4> actual{1.f, 1.f, 1.f, 1.f};
+		actual.Normalise();
+
+		EXPECT_FLOAT_EQ(actual.X(), 0.5f);
+		EXPECT_FLOAT_EQ(actual.Y(), 0.5f);
+		EXPECT_FLOAT_EQ(actual.Z(), 0.5f);
+		EXPECT_FLOAT_EQ(actual.W(), 0.5f);
+	}
+
 	TEST(Vector2Float, ToPolarCoordinates)
 	{
 		PolarCoordinates2D actual = Vector<2>{-3.f, 4.f}.ToPolarCoordinates();
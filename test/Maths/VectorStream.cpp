@@ -0,0 +1,156 @@
+#include "../CustomMatchers.h"
+#include "../../src/Maths/VectorStream.h"
+#include <cstdint>
+#include <vector>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+using testing::Pointwise;
+
+namespace Engine3
+{
+	namespace
+	{
+		// Not a multiple of four, so the scalar remainder is exercised as well as the vectorised groups.
+		template <std::size_t Dimensions>
+		std::vector<Vector<Dimensions>> TestVectors(float offset = 0)
+		{
+			std::vector<Vector<Dimensions>> vectors(11);
+			for (std::size_t i = 0; i < vectors.size(); ++i)
+			{
+				for (std::size_t j = 0; j < Dimensions; ++j)
+				{
+					vectors[i][j] = static_cast<float>(i * Dimensions + j) * 0.5f - 3.f + offset;
+				}
+			}
+
+			return vectors;
+		}
+	}
+
+	TEST(VectorStream3Float, LoadAndStore)
+	{
+		const std::vector<Vector<3>> expected = TestVectors<3>();
+		const VectorStream<3> stream{expected};
+
+		std::vector<Vector<3>> actual(stream.Size());
+		stream.Store(actual);
+
+		EXPECT_EQ(actual, expected);
+	}
+
+	TEST(VectorStream4Float, LoadAndStore)
+	{
+		const std::vector<Vector<4>> expected = TestVectors<4>();
+		const VectorStream<4> stream{expected};
+
+		std::vector<Vector<4>> actual(stream.Size());
+		stream.Store(actual);
+
+		EXPECT_EQ(actual, expected);
+	}
+
+	TEST(VectorStream3Float, ComponentsAreContiguous)
+	{
+		const std::vector<Vector<3>> vectors = TestVectors<3>();
+		VectorStream<3> stream{vectors};
+
+		for (std::size_t i = 0; i < vectors.size(); ++i)
+		{
+			EXPECT_EQ(stream.X()[i], vectors[i].X());
+			EXPECT_EQ(stream.Y()[i], vectors[i].Y());
+			EXPECT_EQ(stream.Z()[i], vectors[i].Z());
+		}
+
+		stream.Y()[2] = 100.f;
+		EXPECT_EQ(stream.Get(2).Y(), 100.f);
+	}
+
+	TEST(VectorStream3Float, ComponentsAreAligned)
+	{
+		const VectorStream<3> stream{TestVectors<3>()};
+
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			EXPECT_EQ(reinterpret_cast<std::uintptr_t>(stream.Component(i).data()) % 64, 0);
+		}
+	}
+
+	TEST(VectorStream3Float, DotProduct)
+	{
+		const std::vector<Vector<3>> lhs = TestVectors<3>();
+		const std::vector<Vector<3>> rhs = TestVectors<3>(1.5f);
+
+		std::vector<float> actual(lhs.size());
+		VectorStream<3>::DotProduct(VectorStream<3>{lhs}, VectorStream<3>{rhs}, actual);
+
+		for (std::size_t i = 0; i < lhs.size(); ++i)
+		{
+			EXPECT_NEAR(actual[i], Vector<3>::DotProduct(lhs[i], rhs[i]), 0.0001);
+		}
+	}
+
+	TEST(VectorStream4Float, LengthSquared)
+	{
+		const std::vector<Vector<4>> vectors = TestVectors<4>();
+
+		std::vector<float> actual(vectors.size());
+		VectorStream<4>{vectors}.LengthSquared(actual);
+
+		for (std::size_t i = 0; i < vectors.size(); ++i) { EXPECT_NEAR(actual[i], vectors[i].LengthSquared(), 0.0001); }
+	}
+
+	TEST(VectorStream3Float, Normalise)
+	{
+		// Offset so none of the vectors are zero.
+		const std::vector<Vector<3>> vectors = TestVectors<3>(0.25f);
+
+		VectorStream<3> stream{vectors};
+		stream.Normalise();
+
+		for (std::size_t i = 0; i < vectors.size(); ++i)
+		{
+			EXPECT_THAT(stream.Get(i), Pointwise(NearWithPrecision(0.0001), vectors[i].Normalised()));
+		}
+	}
+
+	TEST(VectorStream3Float, LinearInterpolation)
+	{
+		const std::vector<Vector<3>> start = TestVectors<3>();
+		const std::vector<Vector<3>> end = TestVectors<3>(4.f);
+
+		VectorStream<3> actual{start.size()};
+		VectorStream<3>::LinearInterpolation(VectorStream<3>{start}, VectorStream<3>{end}, 0.25f, actual);
+
+		for (std::size_t i = 0; i < start.size(); ++i)
+		{
+			EXPECT_THAT(actual.Get(i), Pointwise(NearWithPrecision(0.0001), LinearInterpolation(start[i], end[i], 0.25f)));
+		}
+	}
+
+	TEST(VectorStream3Float, AddAndScale)
+	{
+		const std::vector<Vector<3>> lhs = TestVectors<3>();
+		const std::vector<Vector<3>> rhs = TestVectors<3>(1.5f);
+
+		VectorStream<3> actual{lhs};
+		actual += VectorStream<3>{rhs};
+		actual *= 2.f;
+		actual -= VectorStream<3>{lhs};
+
+		for (std::size_t i = 0; i < lhs.size(); ++i) { EXPECT_EQ(actual.Get(i), (lhs[i] + rhs[i]) * 2.f - lhs[i]); }
+	}
+
+	TEST(VectorStream2Int, PushBackAndGet)
+	{
+		VectorStream<2, int> stream;
+		stream.PushBack({1, 2});
+		stream.PushBack({3, 4});
+
+		EXPECT_EQ(stream.Size(), 2);
+		EXPECT_EQ(stream.Get(1), (Vector<2, int>{3, 4}));
+
+		std::vector<int> actual(stream.Size());
+		VectorStream<2, int>::DotProduct(stream, stream, actual);
+		EXPECT_EQ(actual, (std::vector<int>{5, 25}));
+	}
+}
@@ -0,0 +1,151 @@
+#include "../../src/Jobs/JobSystem.h"
+#include "../../src/Rendering/CommandBuffer.h"
+#include "../../src/Rendering/DrawBatcher.h"
+#include "../../src/Rendering/RecordingBackend.h"
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+namespace Engine3
+{
+	namespace
+	{
+		SortKey Key(ShaderHandle shader, MeshHandle mesh, bool isTranslucent = false, float depth = 0)
+		{
+			return {.IsTranslucent = isTranslucent, .Shader = shader, .Material = shader, .Mesh = mesh, .Depth = depth};
+		}
+
+		// Object i of a scene of a few shaders, meshes and depths, some translucent.
+		SortKey ObjectKey(std::size_t i) { return Key(i % 3, i % 5, i % 7 == 0, (i % 11) / 11.f); }
+
+		Matrix<4> ObjectTransform(std::size_t i) { return Matrix<4>::Translation(static_cast<float>(i), 0.f, 0.f); }
+
+		std::vector<float> InstanceTranslations(const DrawBatcher& batcher)
+		{
+			std::vector<float> translations;
+			for (const Matrix<4>& transform : batcher.GetInstanceTransforms()) { translations.push_back(transform(3, 0)); }
+			return translations;
+		}
+	}
+
+	TEST(CommandBuffer, CommandsComeBackInOrder)
+	{
+		CommandBuffer commands;
+		commands.Draw(Key(1, 2), ObjectTransform(3));
+		commands.Record(SetTranslucentCommand{true});
+		commands.Record(BindShaderCommand{4});
+		commands.Record(BindMeshCommand{5});
+		commands.Record(DrawInstancedCommand{6, 7});
+		EXPECT_EQ(commands.Size(), 5);
+
+		std::vector<RecordedCommand> recorded;
+		commands.ForEach([&recorded](const auto& command) { recorded.emplace_back(command); });
+
+		ASSERT_EQ(recorded.size(), 5);
+		EXPECT_EQ(std::get<DrawCommand>(recorded[0]).Key, Key(1, 2).Pack());
+		EXPECT_EQ(std::get<DrawCommand>(recorded[0]).Transform, ObjectTransform(3));
+		EXPECT_TRUE(std::get<SetTranslucentCommand>(recorded[1]).IsTranslucent);
+		EXPECT_EQ(std::get<BindShaderCommand>(recorded[2]).Shader, 4);
+		EXPECT_EQ(std::get<BindMeshCommand>(recorded[3]).Mesh, 5);
+		EXPECT_EQ(std::get<DrawInstancedCommand>(recorded[4]).FirstInstance, 6);
+		EXPECT_EQ(std::get<DrawInstancedCommand>(recorded[4]).InstanceCount, 7);
+	}
+
+	TEST(CommandBuffer, ClearEmptiesIt)
+	{
+		CommandBuffer commands;
+		commands.Record(BindShaderCommand{0});
+		commands.Clear();
+		EXPECT_TRUE(commands.IsEmpty());
+		EXPECT_EQ(commands.GetByteSize(), 0);
+
+		int count = 0;
+		commands.ForEach([&count](const auto&) { ++count; });
+		EXPECT_EQ(count, 0);
+	}
+
+	TEST(CommandBuffer, RecordedInParallelDrawsTheSameAsInOrder)
+	{
+		constexpr std::size_t objects = 10'000;
+		constexpr std::size_t workers = 8;
+
+		DrawBatcher expected;
+		for (std::size_t i = 0; i < objects; ++i) { expected.Submit(ObjectKey(i), ObjectTransform(i)); }
+		expected.Build();
+
+		// Each worker records a contiguous range of the objects into its own buffer, which are submitted in order.
+		JobSystem jobs{4};
+		std::array<CommandBuffer, workers> buffers;
+		JobCounter counter;
+		for (std::size_t worker = 0; worker < workers; ++worker)
+		{
+			jobs.Run([&buffers, worker]
+			{
+				for (std::size_t i = worker * objects / workers; i < (worker + 1) * objects / workers; ++i)
+				{
+					buffers[worker].Draw(ObjectKey(i), ObjectTransform(i));
+				}
+			}, counter);
+		}
+		jobs.Wait(counter);
+
+		DrawBatcher batcher;
+		for (const CommandBuffer& buffer : buffers) { batcher.Submit(buffer); }
+		batcher.Build();
+
+		EXPECT_EQ(batcher.Size(), objects);
+		EXPECT_EQ(batcher.GetBatches().size(), expected.GetBatches().size());
+		EXPECT_EQ(InstanceTranslations(batcher), InstanceTranslations(expected));
+	}
+
+	TEST(CommandBuffer, EncodedBatchesReplayWithoutErrors)
+	{
+		DrawBatcher batcher;
+		for (int i = 0; i < 1000; ++i) { batcher.Submit(ObjectKey(i), ObjectTransform(i)); }
+		batcher.Build();
+
+		CommandBuffer commands;
+		batcher.Encode(commands);
+
+		RecordingBackend backend{3, 5};
+		Replay(commands, batcher.GetInstanceTransforms(), backend);
+
+		for (const std::string& error : backend.GetErrors()) { ADD_FAILURE() << error; }
+		EXPECT_EQ(backend.GetDrawCallCount(), batcher.GetBatches().size());
+		EXPECT_EQ(backend.GetRedundantBindCount(), 0);
+
+		// Binds are only recorded where the state changes.
+		std::size_t binds = 0;
+		for (const RecordedCommand& command : backend.GetCommands())
+		{
+			binds += std::holds_alternative<BindShaderCommand>(command) || std::holds_alternative<BindMeshCommand>(command);
+		}
+		EXPECT_EQ(binds, batcher.GetStats().ShaderBinds + batcher.GetStats().MeshBinds);
+	}
+
+	TEST(RecordingBackend, FindsInvalidCommands)
+	{
+		const std::array<Matrix<4>, 2> instances{};
+		CommandBuffer commands;
+		commands.Record(DrawInstancedCommand{0, 1});
+		commands.Draw(Key(0, 0), ObjectTransform(0));
+		commands.Record(BindShaderCommand{3});
+		commands.Record(BindMeshCommand{0});
+		commands.Record(BindMeshCommand{0});
+		commands.Record(DrawInstancedCommand{1, 2});
+
+		RecordingBackend backend{3, 5};
+		Replay(commands, instances, backend);
+
+		// No shader or mesh for the first draw, an unbatched draw, a shader that doesn't exist, and too many instances.
+		EXPECT_EQ(backend.GetErrors().size(), 5);
+		EXPECT_EQ(backend.GetRedundantBindCount(), 1);
+		EXPECT_EQ(backend.GetCommands().size(), commands.Size());
+
+		commands.Clear();
+		Replay(commands, instances, backend);
+		EXPECT_TRUE(backend.IsValid());
+	}
+}
@@ -0,0 +1,169 @@
+#include "../../src/Rendering/DrawBatcher.h"
+#include <limits>
+#include <vector>
+#include <gtest/gtest.h>
+
+namespace Engine3
+{
+	namespace
+	{
+		Matrix<4> Translation(float x) { return Matrix<4>::Translation(x, 0.f, 0.f); }
+
+		SortKey Opaque(ShaderHandle shader, MeshHandle mesh, float depth = 0)
+		{
+			return {.Shader = shader, .Material = shader, .Mesh = mesh, .Depth = depth};
+		}
+
+		SortKey Translucent(MeshHandle mesh, float depth)
+		{
+			return {.IsTranslucent = true, .Mesh = mesh, .Depth = depth};
+		}
+
+		std::vector<float> InstanceTranslations(const DrawBatcher& batcher)
+		{
+			std::vector<float> translations;
+			for (const Matrix<4>& transform : batcher.GetInstanceTransforms()) { translations.push_back(transform(3, 0)); }
+			return translations;
+		}
+	}
+
+	TEST(SortKey, UnpackReversesPack)
+	{
+		for (const bool isTranslucent : {false, true})
+		{
+			const SortKey key{15, isTranslucent, 1023, 16383, 131071, 0.5f};
+			const SortKey unpacked = SortKey::Unpack(key.Pack());
+			EXPECT_EQ(unpacked.Layer, key.Layer);
+			EXPECT_EQ(unpacked.IsTranslucent, key.IsTranslucent);
+			EXPECT_EQ(unpacked.Shader, key.Shader);
+			EXPECT_EQ(unpacked.Material, key.Material);
+			EXPECT_EQ(unpacked.Mesh, key.Mesh);
+			EXPECT_NEAR(unpacked.Depth, key.Depth, 1.f / SortKey::MaximumDepth);
+		}
+	}
+
+	TEST(SortKey, OutOfRangeFieldsStayInTheirBits)
+	{
+		for (const bool isTranslucent : {false, true})
+		{
+			const SortKey key{SortKey::LayerCount + 1, isTranslucent, 2, 3, SortKey::MeshCount + 4, 0.5f};
+			const SortKey unpacked = SortKey::Unpack(key.Pack());
+			EXPECT_EQ(unpacked.Layer, 1);
+			EXPECT_EQ(unpacked.IsTranslucent, isTranslucent);
+			EXPECT_EQ(unpacked.Shader, 2);
+			EXPECT_EQ(unpacked.Material, 3);
+			EXPECT_EQ(unpacked.Mesh, 4);
+		}
+	}
+
+	TEST(SortKey, DepthThatIsNotANumberIsNearest)
+	{
+		for (const bool isTranslucent : {false, true})
+		{
+			const SortKey key{.IsTranslucent = isTranslucent, .Depth = std::numeric_limits<float>::quiet_NaN()};
+			EXPECT_EQ(key.Pack(), (SortKey{.IsTranslucent = isTranslucent, .Depth = 0}.Pack()));
+		}
+	}
+
+	TEST(SortKey, Order)
+	{
+		// Layer first, then opaque before translucent.
+		EXPECT_LT(Translucent(5, 0).Pack(), SortKey{.Layer = 1}.Pack());
+		EXPECT_LT(Opaque(9, 9, 1).Pack(), Translucent(0, 1).Pack());
+
+		// Opaque by state, then nearest first. Translucent furthest first, whatever the state.
+		EXPECT_LT(Opaque(0, 1, 0.9f).Pack(), Opaque(1, 0, 0.1f).Pack());
+		EXPECT_LT(Opaque(0, 1, 0.1f).Pack(), Opaque(0, 1, 0.9f).Pack());
+		EXPECT_LT(Translucent(1, 0.9f).Pack(), Translucent(0, 0.1f).Pack());
+
+		EXPECT_EQ(SortKey::WithoutDepth(Opaque(2, 3, 0.1f).Pack()), SortKey::WithoutDepth(Opaque(2, 3, 0.7f).Pack()));
+		EXPECT_EQ(SortKey::WithoutDepth(Translucent(3, 0.1f).Pack()), SortKey::WithoutDepth(Translucent(3, 0.7f).Pack()));
+	}
+
+	TEST(DrawBatcher, GroupsByState)
+	{
+		DrawBatcher batcher;
+		batcher.Submit(Opaque(1, 1, 0.5f), Translation(0));
+		batcher.Submit(Opaque(1, 0), Translation(1));
+		batcher.Submit(Opaque(0, 1), Translation(2));
+		batcher.Submit(Opaque(1, 1, 0.2f), Translation(3));
+		batcher.Submit(Opaque(0, 1), Translation(4));
+		batcher.Build();
+
+		const std::span<const DrawBatch> batches = batcher.GetBatches();
+		ASSERT_EQ(batches.size(), 3);
+		EXPECT_EQ(batches[0].Shader, 0);
+		EXPECT_EQ(batches[0].Mesh, 1);
+		EXPECT_EQ(batches[1].Shader, 1);
+		EXPECT_EQ(batches[1].Mesh, 0);
+		EXPECT_EQ(batches[2].Shader, 1);
+		EXPECT_EQ(batches[2].Mesh, 1);
+
+		// Each batch's instances are contiguous, nearest first, and otherwise in the order they were submitted.
+		EXPECT_EQ(batches[0].FirstInstance, 0);
+		EXPECT_EQ(batches[0].InstanceCount, 2);
+		EXPECT_EQ(batches[1].FirstInstance, 2);
+		EXPECT_EQ(batches[1].InstanceCount, 1);
+		EXPECT_EQ(batches[2].FirstInstance, 3);
+		EXPECT_EQ(batches[2].InstanceCount, 2);
+		EXPECT_EQ(InstanceTranslations(batcher), (std::vector<float>{2, 4, 1, 3, 0}));
+	}
+
+	TEST(DrawBatcher, TranslucentDrawsStayInOrderOfDepth)
+	{
+		DrawBatcher batcher;
+		batcher.Submit(Translucent(0, 0.2f), Translation(0));
+		batcher.Submit(Translucent(1, 0.5f), Translation(1));
+		batcher.Submit(Translucent(0, 0.8f), Translation(2));
+		batcher.Submit(Translucent(0, 0.9f), Translation(3));
+		batcher.Build();
+
+		// The furthest two share a batch, but the one behind the other mesh can't join the nearest.
+		ASSERT_EQ(batcher.GetBatches().size(), 3);
+		EXPECT_EQ(batcher.GetBatches()[0].InstanceCount, 2);
+		EXPECT_EQ(InstanceTranslations(batcher), (std::vector<float>{3, 2, 1, 0}));
+	}
+
+	TEST(DrawBatcher, CountsBindsAvoided)
+	{
+		DrawBatcher batcher;
+		for (int i = 0; i < 10; ++i)
+		{
+			batcher.Submit(Opaque(i % 2, 0), Translation(0));
+			batcher.Submit(Opaque(i % 2, 1), Translation(0));
+		}
+		batcher.Build();
+
+		const DrawStats& stats = batcher.GetStats();
+		EXPECT_EQ(stats.Draws, 20);
+		EXPECT_EQ(stats.Batches, 4);
+		EXPECT_EQ(stats.ShaderBinds, 2);
+		EXPECT_EQ(stats.ShaderBindsAvoided, 2);
+		EXPECT_EQ(stats.MeshBinds, 4);
+		EXPECT_EQ(stats.MeshBindsAvoided, 0);
+	}
+
+	TEST(DrawBatcher, ManyObjectsInAFewBatches)
+	{
+		DrawBatcher batcher;
+		for (int i = 0; i < 100'000; ++i) { batcher.Submit(Opaque(0, i % 4, i / 100'000.f), Matrix<4>::Identity()); }
+		batcher.Build();
+
+		EXPECT_EQ(batcher.GetBatches().size(), 4);
+		EXPECT_EQ(batcher.GetInstanceTransforms().size(), 100'000);
+	}
+
+	TEST(DrawBatcher, ClearKeepsTheBatchesUntilTheNextBuild)
+	{
+		DrawBatcher batcher;
+		batcher.Submit(Opaque(0, 0), Translation(0));
+		batcher.Build();
+		batcher.Clear();
+		EXPECT_EQ(batcher.Size(), 0);
+		EXPECT_EQ(batcher.GetBatches().size(), 1);
+
+		batcher.Build();
+		EXPECT_TRUE(batcher.GetBatches().empty());
+		EXPECT_TRUE(batcher.GetInstanceTransforms().empty());
+	}
+}
@@ -0,0 +1,21 @@
+#include "../../src/Rendering/UniformBlocks.h"
+#include <cstring>
+#include <gtest/gtest.h>
+
+namespace Engine3
+{
+	TEST(UniformBlocks, CameraMatchesStd140RowMajor)
+	{
+		CameraUniforms camera;
+		camera.View = Matrix<4>::Translation(1.f, 2.f, 3.f);
+
+		// Each row of a row major mat4 is a vec4 at 16 bytes past the last, and the view follows the perspective.
+		float row[4];
+		std::memcpy(row, reinterpret_cast<const char*>(&camera) + 64 + 3 * 16, sizeof(row));
+		EXPECT_EQ(row[0], 1.f);
+		EXPECT_EQ(row[1], 2.f);
+		EXPECT_EQ(row[2], 3.f);
+		EXPECT_EQ(row[3], 1.f);
+		EXPECT_EQ(alignof(CameraUniforms) % 16, 0);
+	}
+}
@@ -0,0 +1,53 @@
+#include "../../src/Rendering/UploadRing.h"
+#include <gtest/gtest.h>
+
+namespace Engine3
+{
+	TEST(UploadRing, RegionsAreRoundedToTheMaximumAlignment)
+	{
+		const UploadRing ring{1000};
+		EXPECT_EQ(ring.GetFrameSize(), 1024);
+		EXPECT_EQ(ring.GetFrameCount(), 3);
+		EXPECT_EQ(ring.GetSize(), 3072);
+	}
+
+	TEST(UploadRing, AllocationsAreAlignedAndDontOverlap)
+	{
+		UploadRing ring{1024};
+		EXPECT_EQ(ring.Allocate(10, 4), 0);
+		EXPECT_EQ(ring.Allocate(64, 16), 16);
+		EXPECT_EQ(ring.Allocate(1, 256), 256);
+		EXPECT_EQ(ring.GetUsed(), 257);
+	}
+
+	TEST(UploadRing, FailsWhenTheRegionIsFull)
+	{
+		UploadRing ring{512};
+		EXPECT_EQ(ring.Allocate(500), 0);
+		EXPECT_FALSE(ring.Allocate(16).has_value());
+
+		// Padding that would go past the end fails too, rather than wrapping.
+		EXPECT_FALSE(ring.Allocate(1, 256).has_value());
+		EXPECT_EQ(ring.Allocate(12, 4), 500);
+		EXPECT_EQ(ring.GetUsed(), 512);
+	}
+
+	TEST(UploadRing, EachFrameHasItsOwnRegion)
+	{
+		UploadRing ring{256, 3};
+		EXPECT_EQ(ring.Allocate(100), 0);
+
+		ring.NextFrame();
+		EXPECT_EQ(ring.GetFrame(), 1);
+		EXPECT_EQ(ring.GetUsed(), 0);
+		EXPECT_EQ(ring.Allocate(100), 256);
+
+		ring.NextFrame();
+		EXPECT_EQ(ring.Allocate(100), 512);
+
+		// The first region is reused once every frame after it has been.
+		ring.NextFrame();
+		EXPECT_EQ(ring.GetFrame(), 0);
+		EXPECT_EQ(ring.Allocate(256), 0);
+	}
+}
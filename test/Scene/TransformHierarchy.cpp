@@ -0,0 +1,112 @@
+#include "../CustomMatchers.h"
+#include "../../src/Scene/TransformHierarchy.h"
+#include <numbers>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+using testing::Pointwise;
+
+namespace Engine3
+{
+	namespace
+	{
+		const LocalTransform TestTransform{
+			{4.f, -1.f, 2.5f}, Quaternion<float>::FromAxisAngle({0.f, 1.f, 0.f}, 0.7f), {2.f, 0.5f, 3.f}
+		};
+
+		Matrix<4> Compose(const LocalTransform& local)
+		{
+			const Vector<3>& scale = local.Scale;
+			const Vector<3>& translation = local.Translation;
+			return Matrix<4>::ScalingAlongCardinalAxes(scale.X(), scale.Y(), scale.Z()) * local.Rotation.ToMatrix<4>() *
+				Matrix<4>::Translation(translation.X(), translation.Y(), translation.Z());
+		}
+	}
+
+	TEST(LocalTransform, ToMatrixMatchesComposedMatrices)
+	{
+		EXPECT_THAT(TestTransform.ToMatrix(), Pointwise(NearWithPrecision(0.0001), Compose(TestTransform)));
+	}
+
+	TEST(TransformHierarchy, RootWorldMatrixIsLocal)
+	{
+		TransformHierarchy hierarchy;
+		const auto root = hierarchy.Add(TestTransform);
+		hierarchy.Update();
+
+		EXPECT_THAT(hierarchy.GetWorldMatrix(root), Pointwise(NearWithPrecision(0.0001), Compose(TestTransform)));
+	}
+
+	TEST(TransformHierarchy, ChildIsRelativeToParent)
+	{
+		TransformHierarchy hierarchy;
+		const auto root = hierarchy.Add(TestTransform);
+		const auto child = hierarchy.Add({{0.f, 1.f, 0.f}}, root);
+		const auto grandchild = hierarchy.Add({{1.f, 0.f, 0.f}}, child);
+		hierarchy.Update();
+
+		const Matrix<4> expected =
+			Matrix<4>::Translation(1.f, 0.f, 0.f) * Matrix<4>::Translation(0.f, 1.f, 0.f) * Compose(TestTransform);
+		EXPECT_THAT(hierarchy.GetWorldMatrix(grandchild), Pointwise(NearWithPrecision(0.0001), expected));
+		EXPECT_EQ(hierarchy.GetParent(grandchild), child);
+		EXPECT_EQ(hierarchy.GetParent(root), TransformHierarchy::NoParent);
+	}
+
+	TEST(TransformHierarchy, ChangingParentUpdatesDescendants)
+	{
+		TransformHierarchy hierarchy;
+		const auto root = hierarchy.Add();
+		const auto child = hierarchy.Add({{0.f, 1.f, 0.f}}, root);
+		const auto grandchild = hierarchy.Add({{1.f, 0.f, 0.f}}, child);
+		hierarchy.Update();
+
+		hierarchy.SetRotation(root, Quaternion<float>::FromAxisAngle({0.f, 0.f, 1.f}, std::numbers::pi_v<float> / 2));
+		EXPECT_TRUE(hierarchy.IsDirty());
+		hierarchy.Update();
+		EXPECT_FALSE(hierarchy.IsDirty());
+
+		// (1, 1, 0) rotated a quarter turn anticlockwise about Z.
+		const Matrix<4>& world = hierarchy.GetWorldMatrix(grandchild);
+		EXPECT_THAT((Vector<3>{world(3, 0), world(3, 1), world(3, 2)}),
+		            Pointwise(NearWithPrecision(0.0001), (Vector<3>{-1.f, 1.f, 0.f})));
+	}
+
+	TEST(TransformHierarchy, CleanSiblingsAreNotRecomputed)
+	{
+		TransformHierarchy hierarchy;
+		const auto root = hierarchy.Add();
+		const auto first = hierarchy.Add({{1.f, 0.f, 0.f}}, root);
+		const auto second = hierarchy.Add({{2.f, 0.f, 0.f}}, root);
+		hierarchy.Update();
+
+		const Matrix<4> before = hierarchy.GetWorldMatrix(second);
+		hierarchy.SetTranslation(first, {5.f, 0.f, 0.f});
+		hierarchy.Update();
+
+		EXPECT_EQ(hierarchy.GetWorldMatrix(second), before);
+		EXPECT_EQ(hierarchy.GetWorldMatrix(first), Matrix<4>::Translation(5.f, 0.f, 0.f));
+	}
+
+	TEST(TransformHierarchy, AddAfterUpdate)
+	{
+		TransformHierarchy hierarchy;
+		const auto root = hierarchy.Add({{0.f, 0.f, 3.f}});
+		hierarchy.Update();
+
+		const auto child = hierarchy.Add({{0.f, 2.f, 0.f}}, root);
+		EXPECT_TRUE(hierarchy.IsDirty());
+		hierarchy.Update();
+
+		EXPECT_EQ(hierarchy.GetWorldMatrix(child), Matrix<4>::Translation(0.f, 2.f, 3.f));
+	}
+
+	TEST(TransformHierarchy, Clear)
+	{
+		TransformHierarchy hierarchy;
+		hierarchy.Add();
+		hierarchy.Clear();
+
+		EXPECT_EQ(hierarchy.Size(), 0);
+		EXPECT_FALSE(hierarchy.IsDirty());
+		EXPECT_TRUE(hierarchy.GetWorldMatrices().empty());
+	}
+}
@@ -0,0 +1,89 @@
+#include "../../src/Utility/InlineVector.h"
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+namespace Engine3
+{
+	TEST(InlineVector, StaysInlineUntilFull)
+	{
+		InlineVector<int, 4> vector;
+		const int* inlineData = vector.data();
+		for (int i = 0; i < 4; ++i) { vector.PushBack(i); }
+
+		EXPECT_EQ(vector.data(), inlineData);
+		EXPECT_EQ(vector.Capacity(), 4);
+
+		vector.PushBack(4);
+		EXPECT_NE(vector.data(), inlineData);
+		EXPECT_EQ(std::vector<int>(vector.begin(), vector.end()), (std::vector<int>{0, 1, 2, 3, 4}));
+	}
+
+	TEST(InlineVector, MoveOnlyElements)
+	{
+		InlineVector<std::unique_ptr<int>, 2> vector;
+		for (int i = 0; i < 3; ++i) { vector.EmplaceBack(std::make_unique<int>(i)); }
+
+		InlineVector<std::unique_ptr<int>, 2> moved{std::move(vector)};
+		EXPECT_TRUE(vector.IsEmpty());
+		ASSERT_EQ(moved.Size(), 3);
+		for (int i = 0; i < 3; ++i) { EXPECT_EQ(*moved[i], i); }
+	}
+
+	TEST(InlineVector, MoveInline)
+	{
+		InlineVector<std::string, 2> vector;
+		vector.EmplaceBack("first");
+
+		InlineVector<std::string, 2> moved;
+		moved.EmplaceBack("replaced");
+		moved = std::move(vector);
+
+		EXPECT_TRUE(vector.IsEmpty());
+		ASSERT_EQ(moved.Size(), 1);
+		EXPECT_EQ(moved[0], "first");
+	}
+
+	TEST(InlineVector, Copy)
+	{
+		InlineVector<std::string, 1> vector;
+		vector.EmplaceBack("a");
+		vector.EmplaceBack("b");
+
+		const InlineVector<std::string, 1> copy{vector};
+		vector[0] = "changed";
+
+		ASSERT_EQ(copy.Size(), 2);
+		EXPECT_EQ(copy[0], "a");
+		EXPECT_EQ(copy[1], "b");
+	}
+
+	TEST(InlineVector, ClearDestroysElements)
+	{
+		const auto shared = std::make_shared<int>(0);
+		InlineVector<std::shared_ptr<int>, 2> vector;
+		vector.PushBack(shared);
+		vector.PushBack(shared);
+		vector.PushBack(shared);
+		EXPECT_EQ(shared.use_count(), 4);
+
+		vector.Clear();
+		EXPECT_EQ(shared.use_count(), 1);
+		EXPECT_TRUE(vector.IsEmpty());
+	}
+
+	TEST(InlineVector, PushBackOwnElementWhenFull)
+	{
+		InlineVector<std::string, 2> vector;
+		vector.EmplaceBack("a long enough string to be allocated");
+		vector.EmplaceBack("b");
+
+		// The new element refers into the storage that growing frees.
+		vector.PushBack(vector[0]);
+
+		ASSERT_EQ(vector.Size(), 3);
+		EXPECT_EQ(vector[0], "a long enough string to be allocated");
+		EXPECT_EQ(vector[2], "a long enough string to be allocated");
+	}
+}
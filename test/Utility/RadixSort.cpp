@@ -0,0 +1,57 @@
+#include "../../src/Utility/RadixSort.h"
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+namespace Engine3
+{
+	namespace
+	{
+		using Element = std::pair<std::uint64_t, int>;
+
+		void Sort(std::vector<Element>& elements)
+		{
+			std::vector<Element> scratch(elements.size());
+			RadixSort(std::span{elements}, std::span{scratch}, [](const Element& element) { return element.first; });
+		}
+	}
+
+	TEST(RadixSort, MatchesStableSort)
+	{
+		std::mt19937_64 generator{1};
+		std::vector<Element> elements(10'000);
+		for (std::size_t i = 0; i < elements.size(); ++i)
+		{
+			// Few distinct keys, spread across every byte, so there are plenty of ties to keep in order.
+			elements[i] = {(generator() % 16) * 0x0101010101010101u, static_cast<int>(i)};
+		}
+
+		std::vector<Element> expected = elements;
+		std::ranges::stable_sort(expected, {}, &Element::first);
+		Sort(elements);
+
+		EXPECT_EQ(elements, expected);
+	}
+
+	TEST(RadixSort, SkipsBytesThatNeverDiffer)
+	{
+		// Only the top byte differs, so a single pass, whose result isn't back in the elements, ends up there.
+		std::vector<Element> elements{{3ull << 56, 0}, {1ull << 56, 1}, {2ull << 56, 2}, {1ull << 56, 3}};
+		Sort(elements);
+
+		EXPECT_EQ(elements, (std::vector<Element>{{1ull << 56, 1}, {1ull << 56, 3}, {2ull << 56, 2}, {3ull << 56, 0}}));
+	}
+
+	TEST(RadixSort, EmptyAndSingle)
+	{
+		std::vector<Element> elements;
+		Sort(elements);
+		EXPECT_TRUE(elements.empty());
+
+		elements = {{~0ull, 7}};
+		Sort(elements);
+		EXPECT_EQ(elements, (std::vector<Element>{{~0ull, 7}}));
+	}
+}
@@ -0,0 +1,83 @@
+#include "../../src/Utility/RingBuffer.h"
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+namespace Engine3
+{
+	TEST(RingBuffer, FirstInFirstOut)
+	{
+		RingBuffer<int, 4> buffer;
+		int value = -1;
+		EXPECT_FALSE(buffer.TryPop(value));
+		EXPECT_EQ(value, -1);
+
+		for (int i = 0; i < 3; ++i) { EXPECT_TRUE(buffer.TryPush(i)); }
+		EXPECT_EQ(buffer.Size(), 3);
+		EXPECT_EQ(buffer.Peek(), 0);
+
+		for (int i = 0; i < 3; ++i)
+		{
+			ASSERT_TRUE(buffer.TryPop(value));
+			EXPECT_EQ(value, i);
+		}
+		EXPECT_TRUE(buffer.IsEmpty());
+		EXPECT_FALSE(buffer.Peek().has_value());
+	}
+
+	TEST(RingBuffer, PushFailsWhenFull)
+	{
+		RingBuffer<int, 4> buffer;
+		for (int i = 0; i < 4; ++i) { EXPECT_TRUE(buffer.TryPush(i)); }
+		EXPECT_FALSE(buffer.TryPush(4));
+
+		int value;
+		ASSERT_TRUE(buffer.TryPop(value));
+		EXPECT_EQ(value, 0);
+		EXPECT_TRUE(buffer.TryPush(4));
+		EXPECT_EQ(buffer.Size(), 4);
+	}
+
+	TEST(RingBuffer, Wraps)
+	{
+		RingBuffer<int, 4> buffer;
+		int value;
+		for (int i = 0; i < 100; ++i)
+		{
+			ASSERT_TRUE(buffer.TryPush(i));
+			ASSERT_TRUE(buffer.TryPush(i + 1000));
+			ASSERT_TRUE(buffer.TryPop(value));
+			EXPECT_EQ(value, i);
+			ASSERT_TRUE(buffer.TryPop(value));
+			EXPECT_EQ(value, i + 1000);
+		}
+	}
+
+	TEST(RingBuffer, AcrossThreads)
+	{
+		// Small enough to be full most of the time, so both threads keep catching up with each other.
+		constexpr std::uint32_t count = 200'000;
+		RingBuffer<std::uint32_t, 16> buffer;
+
+		std::thread producer([&buffer]
+		{
+			for (std::uint32_t i = 0; i < count; ++i) { while (!buffer.TryPush(i)) { std::this_thread::yield(); } }
+		});
+
+		std::vector<std::uint32_t> received;
+		received.reserve(count);
+		std::uint32_t value;
+		while (received.size() < count)
+		{
+			if (buffer.TryPop(value)) { received.push_back(value); }
+			else { std::this_thread::yield(); }
+		}
+		producer.join();
+
+		bool inOrder = true;
+		for (std::uint32_t i = 0; i < count; ++i) { inOrder &= received[i] == i; }
+		EXPECT_TRUE(inOrder);
+		EXPECT_TRUE(buffer.IsEmpty());
+	}
+}
@@ -0,0 +1,82 @@
+#include "../../src/Utility/Varint.h"
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <gtest/gtest.h>
+
+namespace Engine3
+{
+	TEST(Varint, RoundTrip)
+	{
+		const std::vector<std::uint64_t> values{
+			0, 1, 127, 128, 300, 16'383, 16'384, std::numeric_limits<std::uint32_t>::max(),
+			std::numeric_limits<std::uint64_t>::max()
+		};
+
+		std::vector<std::uint8_t> bytes;
+		for (std::uint64_t value : values) { WriteVarint(value, bytes); }
+
+		std::span<const std::uint8_t> in{bytes};
+		for (std::uint64_t expected : values)
+		{
+			std::uint64_t value;
+			ASSERT_TRUE(ReadVarint(in, value));
+			EXPECT_EQ(value, expected);
+		}
+		EXPECT_TRUE(in.empty());
+	}
+
+	TEST(Varint, Sizes)
+	{
+		auto size = [](std::uint64_t value)
+		{
+			std::vector<std::uint8_t> bytes;
+			WriteVarint(value, bytes);
+			return bytes.size();
+		};
+
+		EXPECT_EQ(size(0), 1);
+		EXPECT_EQ(size(127), 1);
+		EXPECT_EQ(size(128), 2);
+		EXPECT_EQ(size(std::numeric_limits<std::uint64_t>::max()), MaximumVarintSize);
+
+		std::vector<std::uint8_t> bytes;
+		WriteVarint(300, bytes);
+		EXPECT_EQ(bytes, (std::vector<std::uint8_t>{0xAC, 0x02}));
+	}
+
+	TEST(Varint, RejectsTruncatedAndOverlong)
+	{
+		std::uint64_t value = 7;
+
+		const std::vector<std::uint8_t> truncated{0x80, 0x80};
+		std::span<const std::uint8_t> in{truncated};
+		EXPECT_FALSE(ReadVarint(in, value));
+		EXPECT_EQ(in.size(), 2);
+		EXPECT_EQ(value, 7);
+
+		const std::vector<std::uint8_t> overlong(11, 0xFF);
+		in = overlong;
+		EXPECT_FALSE(ReadVarint(in, value));
+
+		// Ten bytes, but the last has more than the one bit that's left.
+		std::vector<std::uint8_t> overflowing(9, 0xFF);
+		overflowing.push_back(0x02);
+		in = overflowing;
+		EXPECT_FALSE(ReadVarint(in, value));
+	}
+
+	TEST(Varint, ZigZag)
+	{
+		EXPECT_EQ(ZigZagEncode(0), 0);
+		EXPECT_EQ(ZigZagEncode(-1), 1);
+		EXPECT_EQ(ZigZagEncode(1), 2);
+		EXPECT_EQ(ZigZagEncode(-2), 3);
+
+		for (std::int64_t value : {std::int64_t{0}, std::int64_t{-1}, std::int64_t{12345}, std::int64_t{-12345},
+		                           std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max()})
+		{
+			EXPECT_EQ(ZigZagDecode(ZigZagEncode(value)), value);
+		}
+	}
+}